@@ -0,0 +1,319 @@
+/*
+ *++
+ * PROJECT:
+ *  Models to Code Book
+ *
+ * MODULE:
+ *  atcbench.c -- control zone handoff benchmark for the atctrl domain
+ *
+ * ABSTRACT:
+ *  Measures handing off control zones in facilities of several sizes,
+ *  first with the identifier indexes of the domain and then with the
+ *  linear searches of the class storage that they replaced. Each
+ *  measurement runs in a child process using the load test build of the
+ *  domain, filled to the size being measured. The controllers are logged
+ *  in to their duty stations and rounds of "Handoff" events are then
+ *  driven through the data portal, as the test harness does. In each
+ *  round every controller hands the zone it holds to the next controller,
+ *  so the zones move around the controllers and every handoff is one that
+ *  the domain accepts. The next round is generated once the previous one
+ *  has been dispatched. The handoff rate at each size is reported and the
+ *  program exits once all the sizes have been measured.
+ *
+ *--
+ */
+
+/*
+ * INCLUDE FILES
+ */
+#define _POSIX_C_SOURCE 200112L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "mechs.h"
+#include "mechsIndex.h"
+#include "pycca_portal.h"
+#include "atcload.h"
+
+/*
+ * MACRO DEFINITIONS
+ */
+#ifndef ATCBENCH_SECONDS
+#   define ATCBENCH_SECONDS     1.0
+#endif /* ATCBENCH_SECONDS */
+
+#define ATCBENCH_MAXCONTROLLERS ATCTRL_AIR_TRAFFIC_CONTROLLER_INST_COUNT
+
+#define COUNTOF(a)              (sizeof(a) / sizeof(a[0]))
+
+/*
+ * STATIC DATA DEFINITIONS
+ */
+
+/*
+ * The number of controllers in each facility measured. Each facility has
+ * as many duty stations and control zones as controllers.
+ */
+static unsigned const facilitySizes[] = {
+    16, 256, 4096
+} ;
+
+/*
+ * The controllers in instance order and the stations and zones they hold.
+ */
+static InstId_t controllerInsts[ATCBENCH_MAXCONTROLLERS] ;
+static Employee_ID controllerIds[ATCBENCH_MAXCONTROLLERS] ;
+static Station_Number stationNumbers[ATCBENCH_MAXCONTROLLERS] ;
+static Czone_Name zoneHeld[ATCBENCH_MAXCONTROLLERS] ;
+
+static unsigned facilitySize ;
+static bool linearSearch ;
+static unsigned controllers ;
+static bool onDuty ;
+static unsigned long rounds ;
+static unsigned long refused ;
+static double startTime ;
+
+/*
+ * STATIC INLINE FUNCTION DEFINITIONS
+ */
+static inline double
+benchSeconds(void)
+{
+    struct timespec now ;
+    clock_gettime(CLOCK_MONOTONIC, &now) ;
+    return now.tv_sec + now.tv_nsec / 1e9 ;
+}
+
+/*
+ * STATIC FUNCTION DEFINITIONS
+ */
+static void
+benchReport(
+    double elapsed)
+{
+    unsigned long handoffs = rounds * controllers ;
+
+    printf("atcbench: %5u controllers, %-6s %8lu handoffs in %.3f s, "
+            "%9.0f handoffs/s, %8.1f ns/handoff, %lu refused\n",
+            controllers, linearSearch ? "linear" : "index", handoffs,
+            elapsed, handoffs / elapsed, elapsed * 1e9 / handoffs, refused) ;
+}
+
+/*
+ * Generate a round of handoffs. Each controller hands its zone to the
+ * next one, which then holds it for the following round.
+ */
+static void
+benchRound(void)
+{
+    Czone_Name handed = zoneHeld[controllers - 1] ;
+    for (unsigned atc = 0 ; atc < controllers ; ++atc) {
+        EventParamType params ;
+        params.pparm[0] = (void *)zoneHeld[atc] ;
+        params.pparm[1] = (void *)controllerIds[(atc + 1) % controllers] ;
+        pycca_generate_event(&atctrl_portal,
+                ATCTRL_AIR_TRAFFIC_CONTROLLER_CLASS_ID, controllerInsts[atc],
+                NormalEvent, ATCTRL_AIR_TRAFFIC_CONTROLLER_HANDOFF_EVENT_ID,
+                &params) ;
+
+        Czone_Name held = zoneHeld[atc] ;
+        zoneHeld[atc] = handed ;
+        handed = held ;
+    }
+}
+
+/*
+ * Called at the end of every step. Once logged in, each duty station holds
+ * a delayed "Max_shift_exceeded" event for the length of a shift, so no
+ * other events remain when there is one ECB in use for each controller.
+ * The controllers are all on duty when the last of those timers has been
+ * started and nothing else is queued. A round is then complete when the
+ * queue is empty again, since a controller only returns to ON_DUTY, ready
+ * for its next handoff, once its "Handoff_complete" has been dispatched.
+ */
+static void
+benchStep(void)
+{
+    MechStats stats = mechGetStats() ;
+    if (!onDuty) {
+        if (stats->delayedPosted == controllers &&
+                stats->ecbInUse == controllers) {
+            onDuty = true ;
+            startTime = benchSeconds() ;
+            benchRound() ;
+        }
+    } else if (stats->ecbInUse == controllers) {
+        ++rounds ;
+        double elapsed = benchSeconds() - startTime ;
+        if (elapsed >= ATCBENCH_SECONDS) {
+            benchReport(elapsed) ;
+            exit(refused == 0 ? EXIT_SUCCESS : EXIT_FAILURE) ;
+        }
+        benchRound() ;
+    }
+    mechDeferToStepEnd(benchStep) ;
+}
+
+/*
+ * Run each measurement in its own process, so that each starts from the
+ * initial population. Returns in the child process that is to make the
+ * measurement and exits in the parent once they are all done.
+ */
+static void
+benchFacilities(void)
+{
+    int failures = 0 ;
+    for (unsigned s = 0 ; s < COUNTOF(facilitySizes) ; ++s) {
+        for (int linear = 0 ; linear < 2 ; ++linear) {
+            fflush(stdout) ;
+            pid_t child = fork() ;
+            if (child == 0) {
+                facilitySize = facilitySizes[s] ;
+                linearSearch = linear ;
+                return ;
+            }
+            int status ;
+            if (child == -1 || waitpid(child, &status, 0) != child ||
+                    !WIFEXITED(status) ||
+                    WEXITSTATUS(status) != EXIT_SUCCESS) {
+                ++failures ;
+            }
+        }
+    }
+    exit(failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE) ;
+}
+
+/*
+ * EXTERNAL FUNCTION DEFINITIONS
+ */
+
+/*
+ * The domain is compiled with its index look ups renamed to this function.
+ * With "linearSearch" set, controllers and stations are found as they were
+ * before the indexes, by searching the class storage in slot order and
+ * comparing identifiers. Zones were found by searching the zones of the
+ * handing off controller and, since each controller here holds one zone,
+ * that search was a single comparison. Zones are found by the index in
+ * both cases.
+ */
+void *
+atcbenchFind(
+    MechIndex index,
+    void const *key)
+{
+    struct pycca_class_portal const *zones =
+            atctrl_portal.classes + ATCTRL_CONTROL_ZONE_CLASS_ID ;
+    if (!linearSearch || index->storageStart == zones->storage) {
+        return mechIndexFind(index, key) ;
+    }
+
+    char const *inst = index->storageStart ;
+    for (unsigned slot = 0 ; slot < index->instanceCount ;
+            ++slot, inst += index->instanceSize) {
+        if (index->hasCommon && ((MechInstance)inst)->alloc == 0) {
+            continue ;
+        }
+        char const *instKey ;
+        memcpy(&instKey, inst + index->keyOffset, sizeof(instKey)) ;
+        if (instKey != NULL && strcmp(instKey, key) == 0) {
+            return (void *)inst ;
+        }
+    }
+    return NULL ;
+}
+
+/*
+ * External operations that the test harness otherwise provides. A refused
+ * handoff means that the benchmark has lost track of who holds the zones.
+ */
+void
+eop_atctrl_Cannot_handoff_to_self(Employee_ID controller)
+{
+    ++refused ;
+}
+
+void
+eop_atctrl_Unknown_controller(Employee_ID controller)
+{
+    ++refused ;
+}
+
+void
+eop_atctrl_Zone_not_handled_by_controller(Employee_ID controller)
+{
+    ++refused ;
+}
+
+void
+eop_atctrl_Control_Zones_Active(Employee_ID atc)
+{
+}
+
+void
+eop_atctrl_Break_required(Station_Number station)
+{
+}
+
+void
+sysDeviceInit(void)
+{
+}
+
+void
+sysDomainInit(void)
+{
+    benchFacilities() ;
+
+    controllers = atctrl_Load_population(facilitySize) ;
+    atctrl_init() ;
+    /*
+     * The population need not occupy consecutive slots, so the identifiers
+     * are read from the allocated instances in slot order. The n'th
+     * controller, station and zone belong together.
+     */
+    struct pycca_class_portal const *classes = atctrl_portal.classes ;
+    unsigned found = 0 ;
+    for (InstId_t inst = 0 ; inst <
+            classes[ATCTRL_AIR_TRAFFIC_CONTROLLER_CLASS_ID].numInsts ; ++inst) {
+        if (pycca_read_attr(&atctrl_portal,
+                ATCTRL_AIR_TRAFFIC_CONTROLLER_CLASS_ID, inst,
+                ATCTRL_AIR_TRAFFIC_CONTROLLER_ID_ATTR_ID,
+                &controllerIds[found], sizeof(controllerIds[found])) >= 0) {
+            controllerInsts[found++] = inst ;
+        }
+    }
+    found = 0 ;
+    for (InstId_t inst = 0 ;
+            inst < classes[ATCTRL_DUTY_STATION_CLASS_ID].numInsts ; ++inst) {
+        if (pycca_read_attr(&atctrl_portal, ATCTRL_DUTY_STATION_CLASS_ID,
+                inst, ATCTRL_DUTY_STATION_NUMBER_ATTR_ID,
+                &stationNumbers[found], sizeof(stationNumbers[found])) >= 0) {
+            ++found ;
+        }
+    }
+    found = 0 ;
+    for (InstId_t inst = 0 ;
+            inst < classes[ATCTRL_CONTROL_ZONE_CLASS_ID].numInsts ; ++inst) {
+        if (pycca_read_attr(&atctrl_portal, ATCTRL_CONTROL_ZONE_CLASS_ID,
+                inst, ATCTRL_CONTROL_ZONE_NAME_ATTR_ID,
+                &zoneHeld[found], sizeof(zoneHeld[found])) >= 0) {
+            ++found ;
+        }
+    }
+
+    for (unsigned atc = 0 ; atc < controllers ; ++atc) {
+        EventParamType params ;
+        params.pparm[0] = (void *)stationNumbers[atc] ;
+        pycca_generate_event(&atctrl_portal,
+                ATCTRL_AIR_TRAFFIC_CONTROLLER_CLASS_ID, controllerInsts[atc],
+                NormalEvent,
+                ATCTRL_AIR_TRAFFIC_CONTROLLER_READY_FOR_DUTY_EVENT_ID,
+                &params) ;
+    }
+    mechDeferToStepEnd(benchStep) ;
+}
@@ -14,6 +14,7 @@
  */
 #include "harness.h"
 #include "mechs.h"
+#include "atctrl.h"
 #include "atcharness.h"
 
 /*
@@ -55,6 +56,7 @@ sysDeviceInit(void)
 void
 sysDomainInit(void)
 {
+    atctrl_init() ;
     harness_init() ;
     atctrl_harness_init() ;
 }
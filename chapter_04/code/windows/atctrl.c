@@ -215,14 +215,21 @@
 #include <assert.h>
 #include <time.h>
 #include <string.h>
+#include "mechsIndex.h"
 #include "atctrl.h"
 typedef char const *Name_T ;
 typedef time_t Date_T ;
+#define CurrentDate()   ((Date_T)(mechNowEpoch() / 1000000))
 typedef unsigned Aircraft_Quantity ;
 typedef unsigned Aircraft_Maximum ;
 typedef unsigned Duration ;
 typedef char const *Experience_Level ;
 
+// Identifier indexes built by the "init" domain operation.
+static struct mechindex controllerIndex ;
+static struct mechindex stationIndex ;
+static struct mechindex zoneIndex ;
+
 
 #ifdef INSTRUMENT
 #   ifndef INSTR_FUNC
@@ -772,7 +779,7 @@ static void Air_Traffic_Controller_Logging_Out(void *const s_, void *const p_)
     //+ Last shift ended = _now.HMS
     ClassRefVar(Off_Duty_Controller, offdc) =
             PYCCA_unionSubtype(self, R1, Off_Duty_Controller) ;
-    offdc->Last_shift_ended = time(NULL) ;
+    offdc->Last_shift_ended = CurrentDate() ;
 
     //+ Off duty -> me
     PYCCA_generateToSelf(Off_duty) ;
@@ -813,18 +820,14 @@ static void Air_Traffic_Controller_Handing_off_Control_Zone(void *const s_, void
     } const *const rcvd_evt = (struct Air_Traffic_Controller_Handing_off_Control_Zone_rcvd_evt const *)p_ ;
 
     //+ hoff zone .= /R2/Control Zone( Name: in.Zone )
+    /*
+     * Rather than search the zones linked to this controller, the zone
+     * is found by name and is one of ours if it refers back to us.
+     */
     ClassRefVar(On_Duty_Controller, ondc) =
             PYCCA_unionSubtype(self, R1, On_Duty_Controller) ;
-    ClassRefVar(Control_Zone, hoff_zone) = NULL ;
-    rlink_t *czlink ;
-    PYCCA_forAllLinkedInst(ondc, R2, czlink) {
-        ClassRefVar(Control_Zone, found) =
-                PYCCA_linkToInstRef(czlink, Control_Zone, R2) ;
-        if (strcmp(rcvd_evt->zone, found->Name) == 0) {
-            hoff_zone = found ;
-            break ;
-        }
-    }
+    ClassRefVar(Control_Zone, hoff_zone) =
+            mechIndexFind(&zoneIndex, rcvd_evt->zone) ;
     assert(hoff_zone != NULL) ;
 
     //+ if in.Controller == ID
@@ -833,14 +836,11 @@ static void Air_Traffic_Controller_Handing_off_Control_Zone(void *const s_, void
         ExternalOp(Cannot_handoff_to_self)(rcvd_evt->controller) ;
     } else {
         //+ new controller .= On Duty Controller( ID: in.Controller )
-        ClassRefVar(Air_Traffic_Controller, new_controller) ;
-        PYCCA_selectOneStaticInstWhere(new_controller,
-            Air_Traffic_Controller,
-            strcmp(new_controller->ID, rcvd_evt->controller) == 0 &&
-            new_controller->SubCodeMember(R1) ==
-                SubCodeValue(Air_Traffic_Controller, R1, On_Duty_Controller)) ;
-
-        if (new_controller == EndStorage(Air_Traffic_Controller)) {
+        ClassRefVar(Air_Traffic_Controller, new_controller) =
+                mechIndexFind(&controllerIndex, rcvd_evt->controller) ;
+
+        if (new_controller == NULL || new_controller->SubCodeMember(R1) !=
+                SubCodeValue(Air_Traffic_Controller, R1, On_Duty_Controller)) {
             //+ !new missing: UI.Unknown controller( Controller: in.Controller)
             ExternalOp(Unknown_controller)(rcvd_evt->controller) ;
         } else if (hoff_zone->R2 != ondc) {
@@ -881,7 +881,7 @@ static void Air_Traffic_Controller_Verifying_Adequate_Break(void *const s_, void
 
     //+ if ( _now - self.Last shift ended < the shift spec.Min break )
     if (offdc->Last_shift_ended == 0 ||
-            time(NULL) - offdc->Last_shift_ended < the_shift_spec->Min_break) {
+            CurrentDate() - offdc->Last_shift_ended < the_shift_spec->Min_break) {
         //+ Log in( in.Station ) -> me
         MechEcb li_sig = PYCCA_newEvent(Log_in, Air_Traffic_Controller, self,
                 self) ;
@@ -908,10 +908,9 @@ static void Air_Traffic_Controller_Logging_In(void *const s_, void *const p_)
             On_Duty_Controller) ;
 
     //+ my station = Duty Station( Number: in.Station )
-    ClassRefVar(Duty_Station, my_station) ;
-    PYCCA_selectOneStaticInstWhere(my_station, Duty_Station,
-            strcmp(my_station->Number, rcvd_evt->Station) == 0) ;
-    assert(my_station != EndStorage(Duty_Station)) ;
+    ClassRefVar(Duty_Station, my_station) =
+            mechIndexFind(&stationIndex, rcvd_evt->Station) ;
+    assert(my_station != NULL) ;
 
     //+ & /R3/my station    // link station
     ClassRefVar(On_Duty_Controller, ondc) =
@@ -920,7 +919,7 @@ static void Air_Traffic_Controller_Logging_In(void *const s_, void *const p_)
     my_station->R3 = ondc ;
 
     //+ Time logged in = _now.HMS
-    ondc->Time_logged_in = time(NULL) ;
+    ondc->Time_logged_in = CurrentDate() ;
 
     //+ Logged in -> me
     PYCCA_generateToSelf(Logged_in) ;
@@ -986,7 +985,47 @@ void atctrl_init(void)
 {
     INSTR_FUNC("atctrl.init") ;
 
-    // Your code here.
+    static MechIndexSlot controllerBuckets[
+            MECH_INDEX_BUCKETS(COUNTOF(BeginStorage(Air_Traffic_Controller)))] ;
+    controllerIndex = (struct mechindex) {
+        .storageStart = BeginStorage(Air_Traffic_Controller),
+        .instanceSize = sizeof(struct Air_Traffic_Controller),
+        .instanceCount = COUNTOF(BeginStorage(Air_Traffic_Controller)),
+        .keyOffset = offsetof(struct Air_Traffic_Controller, ID),
+        .keyType = MechKeyStringRef,
+        .hasCommon = true,
+        .buckets = controllerBuckets,
+        .bucketCount = COUNTOF(controllerBuckets),
+    } ;
+    mechIndexInit(&controllerIndex) ;
+
+    static MechIndexSlot stationBuckets[
+            MECH_INDEX_BUCKETS(COUNTOF(BeginStorage(Duty_Station)))] ;
+    stationIndex = (struct mechindex) {
+        .storageStart = BeginStorage(Duty_Station),
+        .instanceSize = sizeof(struct Duty_Station),
+        .instanceCount = COUNTOF(BeginStorage(Duty_Station)),
+        .keyOffset = offsetof(struct Duty_Station, Number),
+        .keyType = MechKeyStringRef,
+        .hasCommon = true,
+        .buckets = stationBuckets,
+        .bucketCount = COUNTOF(stationBuckets),
+    } ;
+    mechIndexInit(&stationIndex) ;
+
+    static MechIndexSlot zoneBuckets[
+            MECH_INDEX_BUCKETS(COUNTOF(BeginStorage(Control_Zone)))] ;
+    zoneIndex = (struct mechindex) {
+        .storageStart = BeginStorage(Control_Zone),
+        .instanceSize = sizeof(struct Control_Zone),
+        .instanceCount = COUNTOF(BeginStorage(Control_Zone)),
+        .keyOffset = offsetof(struct Control_Zone, Name),
+        .keyType = MechKeyStringRef,
+        .hasCommon = false,
+        .buckets = zoneBuckets,
+        .bucketCount = COUNTOF(zoneBuckets),
+    } ;
+    mechIndexInit(&zoneIndex) ;
 }
 
 /*
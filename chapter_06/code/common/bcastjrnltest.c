@@ -0,0 +1,315 @@
+/*
+ *++
+ * PROJECT:
+ *  Models to Code Book
+ *
+ * MODULE:
+ *  bcastjrnltest.c -- broadcast event delivery and recovery test
+ *
+ * ABSTRACT:
+ *  Checks that a broadcast event reaches each allocated instance of its
+ *  class once, and no other storage slot, that the predicate narrows the
+ *  targets and that a target deleted by the action of an earlier one is
+ *  passed over. It then checks that a broadcast is recovered from the
+ *  journal. A child process posts a broadcast, delivers it to one target,
+ *  takes a checkpoint, delivers it to one more and posts a second
+ *  broadcast before it exits without dispatching the rest. The parent
+ *  recovers and dispatches what remains, after which each instance must
+ *  have been reached exactly as often as if the child had run on. The
+ *  result is reported and the program exits.
+ *
+ *--
+ */
+
+/*
+ * INCLUDE FILES
+ */
+#define _POSIX_C_SOURCE 200112L
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "mechs.h"
+#include "mechsJournal.h"
+#include "pycca_portal.h"
+
+/*
+ * MACRO DEFINITIONS
+ */
+#define BCAST_LOG               "bcastjrnltest.journal"
+#define BCAST_CHECKPOINT        "bcastjrnltest.checkpoint"
+
+#define BCAST_SLOTS             8
+#define BCAST_PING              0
+#define BCAST_NO_VICTIM         UINT8_MAX
+
+#define COUNTOF(a)              (sizeof(a) / sizeof(a[0]))
+
+/*
+ * TYPE DEFINITIONS
+ */
+struct beacon {
+    struct mechinstance common_ ;
+    unsigned pings ;
+    bool lit ;
+    uint8_t victim ;
+} ;
+
+/*
+ * FORWARD FUNCTION DECLARATIONS
+ */
+static void beaconPing(void *const, void *const) ;
+
+/*
+ * STATIC DATA DEFINITIONS
+ */
+static struct beacon beaconStorage[BCAST_SLOTS] ;
+
+static struct installocblock beaconAllocBlock = {
+    .storageStart = beaconStorage,
+    .storageFinish = beaconStorage + BCAST_SLOTS,
+    .storageLast = beaconStorage + BCAST_SLOTS - 1,
+    .instanceSize = sizeof(struct beacon),
+} ;
+
+/*
+ * One state with one event that transitions back to it.
+ */
+static StateCode const beaconTransitions[] = { 0 } ;
+static PtrActionFunction const beaconActions[] = { beaconPing } ;
+
+static struct objectdispatchblock const beaconDispatch = {
+    .stateCount = 1,
+    .eventCount = 1,
+    .transitionTable = beaconTransitions,
+    .actionTable = beaconActions,
+} ;
+
+static struct mechclass const beaconClass = {
+    .iab = &beaconAllocBlock,
+    .odb = &beaconDispatch,
+} ;
+
+static struct pycca_attr_portal const beaconAttrs[] = {
+    { offsetof(struct beacon, pings), sizeof(unsigned) },
+    { offsetof(struct beacon, lit), sizeof(bool) },
+    { offsetof(struct beacon, victim), sizeof(uint8_t) },
+} ;
+
+static struct pycca_class_portal const beaconClasses[] = {
+    {
+        .storage = beaconStorage,
+        .attrs = beaconAttrs,
+        .mechClass = &beaconClass,
+        .numAttrs = COUNTOF(beaconAttrs),
+        .numInsts = BCAST_SLOTS,
+        .instSize = sizeof(struct beacon),
+        .instOffset = 0,
+        .isConst = false,
+        .hasCommon = true,
+        .initialState = 0,
+    },
+} ;
+
+static struct pycca_domain_portal const beaconPortal = {
+    .classes = beaconClasses,
+    .numClasses = COUNTOF(beaconClasses),
+} ;
+
+static unsigned failures ;
+
+/*
+ * STATIC FUNCTION DEFINITIONS
+ */
+static void
+bcastCheck(
+    bool ok,
+    char const *what)
+{
+    printf("bcastjrnltest: %s: %s\n", what, ok ? "ok" : "FAILED") ;
+    if (!ok) {
+        ++failures ;
+    }
+}
+
+/*
+ * The action of the beacon class. It counts the event and deletes the
+ * instance it has been given, if any.
+ */
+static void
+beaconPing(
+    void *const s,
+    void *const p)
+{
+    struct beacon *const self = s ;
+    ++self->pings ;
+
+    if (self->victim != BCAST_NO_VICTIM) {
+        struct beacon *victim = beaconStorage + self->victim ;
+        self->victim = BCAST_NO_VICTIM ;
+        if (victim->common_.alloc != 0) {
+            mechInstDestroy(&victim->common_) ;
+        }
+    }
+}
+
+static bool
+beaconLit(
+    MechInstance inst)
+{
+    return ((struct beacon *)inst)->lit ;
+}
+
+static struct beacon *
+beaconCreate(
+    bool lit)
+{
+    struct beacon *beacon =
+            (struct beacon *)mechInstCreate(&beaconClass, 0) ;
+    beacon->pings = 0 ;
+    beacon->lit = lit ;
+    beacon->victim = BCAST_NO_VICTIM ;
+    return beacon ;
+}
+
+/*
+ * Dispatch the events that are queued. Returns the number dispatched.
+ */
+static unsigned long
+bcastDispatchAll(void)
+{
+    unsigned long before = mechGetStats()->eventsDispatched ;
+    while (mechEventDispatchNext()) {
+        /*
+         * Empty
+         */
+    }
+    return mechGetStats()->eventsDispatched - before ;
+}
+
+/*
+ * Broadcast and dispatch until done. Returns true if the number of
+ * dispatches and the pings of each slot changed as expected.
+ */
+static bool
+bcastDeliver(
+    MechInstPredicate predicate,
+    unsigned const expected[BCAST_SLOTS])
+{
+    unsigned before[BCAST_SLOTS] ;
+    unsigned targets = 0 ;
+    for (unsigned slot = 0 ; slot < BCAST_SLOTS ; ++slot) {
+        before[slot] = beaconStorage[slot].pings ;
+        targets += expected[slot] ;
+    }
+    mechEventBroadcast(BCAST_PING, &beaconClass, predicate, NULL) ;
+    bool ok = bcastDispatchAll() == targets ;
+    for (unsigned slot = 0 ; slot < BCAST_SLOTS ; ++slot) {
+        ok = ok && beaconStorage[slot].pings - before[slot] == expected[slot] ;
+    }
+    return ok && mechGetStats()->ecbInUse == 0 ;
+}
+
+/*
+ * The run that is recovered. It exits without closing the journal, as
+ * if it had stopped, part way through the second broadcast.
+ */
+static void
+bcastFirstRun(void)
+{
+    if (mechJournalRegisterPortal(&beaconPortal) != 0 ||
+            mechJournalOpen(BCAST_LOG, BCAST_CHECKPOINT) != 0) {
+        _exit(EXIT_FAILURE) ;
+    }
+    mechEventBroadcast(BCAST_PING, &beaconClass, NULL, NULL) ;
+    if (!mechEventDispatchNext() || mechJournalCheckpoint() != 0 ||
+            !mechEventDispatchNext()) {
+        _exit(EXIT_FAILURE) ;
+    }
+    mechEventBroadcast(BCAST_PING, &beaconClass, beaconLit, NULL) ;
+    mechJournalCommit() ;
+    _exit(EXIT_SUCCESS) ;
+}
+
+/*
+ * EXTERNAL FUNCTION DEFINITIONS
+ */
+void
+sysDeviceInit(void)
+{
+}
+
+void
+sysDomainInit(void)
+{
+    /*
+     * Slots 0 to 5 are filled and then 2 and 4 are freed. The instances
+     * in slots 1 and 5 are lit.
+     */
+    for (unsigned slot = 0 ; slot < 6 ; ++slot) {
+        beaconCreate(slot == 1 || slot == 5) ;
+    }
+    mechInstDestroy(&beaconStorage[2].common_) ;
+    mechInstDestroy(&beaconStorage[4].common_) ;
+
+    bcastCheck(bcastDeliver(NULL,
+            (unsigned const [BCAST_SLOTS]){ 1, 1, 0, 1, 0, 1, 0, 0 }),
+            "broadcast reaches the allocated instances only") ;
+    bcastCheck(bcastDeliver(beaconLit,
+            (unsigned const [BCAST_SLOTS]){ 0, 1, 0, 0, 0, 1, 0, 0 }),
+            "broadcast reaches the instances of the predicate only") ;
+    /*
+     * The most recently created instance is reached first and deletes the
+     * one that would be reached next.
+     */
+    beaconStorage[5].victim = 3 ;
+    bcastCheck(bcastDeliver(NULL,
+            (unsigned const [BCAST_SLOTS]){ 1, 1, 0, 0, 0, 1, 0, 0 }),
+            "broadcast passes over a deleted target") ;
+    /*
+     * The new instance reuses slot 3, so the allocated instances are not
+     * in the order of their slots.
+     */
+    beaconCreate(false) ;
+    bcastCheck(beaconStorage[3].common_.alloc != 0,
+            "instance created in a freed slot") ;
+
+    unsigned before[BCAST_SLOTS] ;
+    for (unsigned slot = 0 ; slot < BCAST_SLOTS ; ++slot) {
+        before[slot] = beaconStorage[slot].pings ;
+    }
+
+    unlink(BCAST_LOG) ;
+    unlink(BCAST_CHECKPOINT) ;
+    fflush(stdout) ;
+    pid_t child = fork() ;
+    if (child == 0) {
+        bcastFirstRun() ;
+    }
+    int status ;
+    bcastCheck(child != -1 && waitpid(child, &status, 0) == child &&
+            WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS,
+            "first run journaled") ;
+
+    int replayed = -1 ;
+    if (mechJournalRegisterPortal(&beaconPortal) == 0 &&
+            mechJournalOpen(BCAST_LOG, BCAST_CHECKPOINT) == 0) {
+        replayed = mechJournalRecover() ;
+    }
+    bcastCheck(replayed == 1, "recovered with one record replayed") ;
+    bcastDispatchAll() ;
+
+    static unsigned const recovered[BCAST_SLOTS] = { 1, 2, 0, 1, 0, 2, 0, 0 } ;
+    bool ok = mechGetStats()->ecbInUse == 0 ;
+    for (unsigned slot = 0 ; slot < BCAST_SLOTS ; ++slot) {
+        ok = ok && beaconStorage[slot].pings - before[slot] ==
+                recovered[slot] ;
+    }
+    bcastCheck(ok, "recovered broadcasts reach each instance once") ;
+    mechJournalClose() ;
+
+    printf("bcastjrnltest: %s\n", failures == 0 ? "PASSED" : "FAILED") ;
+    exit(failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE) ;
+}
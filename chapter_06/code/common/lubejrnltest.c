@@ -0,0 +1,253 @@
+/*
+ *++
+ * PROJECT:
+ *  Models to Code Book
+ *
+ * MODULE:
+ *  lubejrnltest.c -- journal recovery test for the lube domain
+ *
+ * ABSTRACT:
+ *  Checks that the indexes over class storage are correct after the
+ *  domain is recovered from its journal. A child process renames one
+ *  Lubrication Schedule, takes a checkpoint, renames a second one and
+ *  then exits without a further checkpoint, so that the first rename is
+ *  recovered from the checkpoint and the second by replaying the log.
+ *  The parent then recovers the domain and looks the schedules up by
+ *  name through an index that it registered beforehand. The result is
+ *  reported and the program exits.
+ *
+ *--
+ */
+
+/*
+ * INCLUDE FILES
+ */
+#define _POSIX_C_SOURCE 200112L
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "mechs.h"
+#include "mechsIndex.h"
+#include "mechsJournal.h"
+#include "pycca_portal.h"
+#include "lube.h"
+
+/*
+ * MACRO DEFINITIONS
+ */
+#define LUBEJRNL_LOG            "lubejrnltest.journal"
+#define LUBEJRNL_CHECKPOINT     "lubejrnltest.checkpoint"
+
+#define COUNTOF(a)              (sizeof(a) / sizeof(a[0]))
+
+/*
+ * STATIC DATA DEFINITIONS
+ */
+static struct mechindex nameIndex ;
+static MechIndexSlot nameBuckets[
+        MECH_INDEX_BUCKETS(LUBE_LUBRICATION_SCHEDULE_INST_COUNT)] ;
+
+/*
+ * The new names of the first two schedules. The child and parent are the
+ * same program image, so the pointers saved by the child are valid in the
+ * parent.
+ */
+static char const *const newNames[] = {
+    "Recovered from checkpoint",
+    "Recovered from log",
+} ;
+
+static unsigned failures ;
+
+/*
+ * STATIC FUNCTION DEFINITIONS
+ */
+static void
+jrnlCheck(
+    bool ok,
+    char const *what)
+{
+    printf("lubejrnltest: %s: %s\n", what, ok ? "ok" : "FAILED") ;
+    if (!ok) {
+        ++failures ;
+    }
+}
+
+static void *
+jrnlSchedule(
+    InstId_t inst)
+{
+    struct pycca_class_portal const *sched =
+            lube_portal.classes + LUBE_LUBRICATION_SCHEDULE_CLASS_ID ;
+    return (char *)sched->storage + inst * sched->instSize ;
+}
+
+static int
+jrnlRename(
+    InstId_t inst)
+{
+    return pycca_update_attr(&lube_portal,
+            LUBE_LUBRICATION_SCHEDULE_CLASS_ID, inst,
+            LUBE_LUBRICATION_SCHEDULE_NAME_ATTR_ID, &newNames[inst],
+            sizeof(newNames[inst])) ;
+}
+
+/*
+ * The run that is recovered. It exits without closing the journal, as
+ * if it had stopped, once the second rename is committed.
+ */
+static void
+jrnlFirstRun(void)
+{
+    if (mechJournalRegisterPortal(&lube_portal) != 0 ||
+            mechJournalOpen(LUBEJRNL_LOG, LUBEJRNL_CHECKPOINT) != 0 ||
+            jrnlRename(0) < 0 ||
+            mechJournalCheckpoint() != 0 ||
+            jrnlRename(1) < 0) {
+        _exit(EXIT_FAILURE) ;
+    }
+    mechJournalCommit() ;
+    _exit(EXIT_SUCCESS) ;
+}
+
+/*
+ * EXTERNAL FUNCTION DEFINITIONS
+ */
+
+/*
+ * External operations that the test harness otherwise provides.
+ */
+void
+eop_lube_UI_Deactivated(InstId_t sessionId)
+{
+}
+
+void
+eop_lube_App_Error(char const *Msg)
+{
+}
+
+void
+eop_lube_SIO_Inject(InstId_t injectorId)
+{
+}
+
+void
+eop_lube_SIO_Stop_injecting(InstId_t injectorId)
+{
+}
+
+void
+eop_lube_SIO_Start_monitoring(InstId_t injectorId)
+{
+}
+
+void
+eop_lube_SIO_Stop_monitoring(InstId_t injectorId)
+{
+}
+
+void
+eop_lube_ALARM_Set_pressure_error(InstId_t injectorId)
+{
+}
+
+void
+eop_lube_ALARM_Set_dissipation_error(InstId_t injectorId)
+{
+}
+
+void
+eop_lube_ALARM_Clear_dissipation_error(InstId_t injectorId)
+{
+}
+
+void
+eop_lube_ALARM_Set_lube_level_very_low(InstId_t reservoirId)
+{
+}
+
+void
+eop_lube_ALARM_Clear_lube_level_very_low(InstId_t reservoirId)
+{
+}
+
+void
+eop_lube_ALARM_Set_lube_level_low(InstId_t reservoirId)
+{
+}
+
+void
+eop_lube_ALARM_Clear_lube_level_low(InstId_t reservoirId)
+{
+}
+
+void
+eop_lube_ALARM_Set_lube_level_empty(InstId_t reservoirId)
+{
+}
+
+void
+eop_lube_ALARM_Clear_lube_level_empty(InstId_t reservoirId)
+{
+}
+
+void
+sysDeviceInit(void)
+{
+}
+
+void
+sysDomainInit(void)
+{
+    lube_init() ;
+
+    struct pycca_class_portal const *sched =
+            lube_portal.classes + LUBE_LUBRICATION_SCHEDULE_CLASS_ID ;
+    nameIndex = (struct mechindex) {
+        .storageStart = sched->storage,
+        .instanceSize = sched->instSize,
+        .instanceCount = sched->numInsts,
+        .keyOffset = sched->attrs[LUBE_LUBRICATION_SCHEDULE_NAME_ATTR_ID].offset,
+        .keyType = MechKeyStringRef,
+        .hasCommon = false,
+        .buckets = nameBuckets,
+        .bucketCount = COUNTOF(nameBuckets),
+    } ;
+    mechIndexInit(&nameIndex) ;
+
+    char const *oldName ;
+    pycca_read_attr(&lube_portal, LUBE_LUBRICATION_SCHEDULE_CLASS_ID, 0,
+            LUBE_LUBRICATION_SCHEDULE_NAME_ATTR_ID, &oldName, sizeof(oldName)) ;
+
+    unlink(LUBEJRNL_LOG) ;
+    unlink(LUBEJRNL_CHECKPOINT) ;
+    fflush(stdout) ;
+    pid_t child = fork() ;
+    if (child == 0) {
+        jrnlFirstRun() ;
+    }
+    int status ;
+    jrnlCheck(child != -1 && waitpid(child, &status, 0) == child &&
+            WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS,
+            "first run journaled") ;
+
+    int replayed = -1 ;
+    if (mechJournalRegisterPortal(&lube_portal) == 0 &&
+            mechJournalOpen(LUBEJRNL_LOG, LUBEJRNL_CHECKPOINT) == 0) {
+        replayed = mechJournalRecover() ;
+    }
+    jrnlCheck(replayed == 1, "recovered with one record replayed") ;
+    jrnlCheck(mechIndexFind(&nameIndex, newNames[0]) == jrnlSchedule(0),
+            "schedule renamed before the checkpoint found by name") ;
+    jrnlCheck(mechIndexFind(&nameIndex, newNames[1]) == jrnlSchedule(1),
+            "schedule renamed after the checkpoint found by name") ;
+    jrnlCheck(mechIndexFind(&nameIndex, oldName) == NULL,
+            "old name no longer found") ;
+    mechJournalClose() ;
+
+    printf("lubejrnltest: %s\n", failures == 0 ? "PASSED" : "FAILED") ;
+    exit(failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE) ;
+}
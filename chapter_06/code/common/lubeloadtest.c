@@ -0,0 +1,192 @@
+/*
+ *++
+ * PROJECT:
+ *  Models to Code Book
+ *
+ * MODULE:
+ *  lubeloadtest.c -- load test for the lube domain
+ *
+ * ABSTRACT:
+ *  Runs the lube domain with an Injector and Autocycle Session in every
+ *  slot of the load test population. The sessions are started in
+ *  batches by the domain initialization and then activated for
+ *  continuous operation. Once all the sessions are running, the event
+ *  and timer load they place on the mechanisms is measured for a fixed
+ *  time and reported. The program exits once the time is up.
+ *
+ *--
+ */
+
+/*
+ * INCLUDE FILES
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "mechs.h"
+#include "lubeload.h"
+
+/*
+ * MACRO DEFINITIONS
+ */
+#ifndef LUBELOAD_SECONDS
+#   define LUBELOAD_SECONDS     10
+#endif /* LUBELOAD_SECONDS */
+
+/*
+ * STATIC DATA ALLOCATION
+ */
+static unsigned sessionCount ;
+static bool activated ;
+static MechTime startupBegin ;
+static MechTime runBegin ;
+static clock_t runCpuBegin ;
+static struct mechstats runStats ;
+
+/*
+ * STATIC FUNCTION DEFINITIONS
+ */
+static void
+loadReport(
+    MechTime now)
+{
+    MechStats stats = mechGetStats() ;
+    double elapsed = (now - runBegin) / 1e6 ;
+    double cpu = (double)(clock() - runCpuBegin) / CLOCKS_PER_SEC ;
+    unsigned long dispatched =
+            stats->eventsDispatched - runStats.eventsDispatched ;
+    unsigned long posted = stats->delayedPosted - runStats.delayedPosted ;
+    unsigned long expired =
+            stats->timerExpirations - runStats.timerExpirations ;
+
+    printf("lubeload: %u sessions, %lu events in %.3f s, %.0f events/s\n",
+            sessionCount, dispatched, elapsed, dispatched / elapsed) ;
+    printf("lubeload: %.0f delayed events/s, %.0f timer expirations/s\n",
+            posted / elapsed, expired / elapsed) ;
+    printf("lubeload: %.0f%% of the processor, %.0f ns per event, "
+            "%u ECBs in use, %u at most\n",
+            cpu * 100 / elapsed, cpu * 1e9 / dispatched,
+            stats->ecbInUse, stats->ecbMaxInUse) ;
+}
+/*
+ * Called at the end of every step. Until all the sessions have been
+ * activated, it activates those that have been started. It then lets the
+ * sessions run for the test time before reporting.
+ */
+static void
+loadStep(void)
+{
+    MechTime now = mechNow() ;
+    if (!activated) {
+        if (startupBegin == 0) {
+            startupBegin = now ;
+        }
+        activated = lube_Activate_load_sessions() ;
+        if (activated) {
+            printf("lubeload: %u sessions started and activated in %.3f s\n",
+                    sessionCount, (now - startupBegin) / 1e6) ;
+            runBegin = now ;
+            runCpuBegin = clock() ;
+            runStats = *mechGetStats() ;
+        }
+    } else if (now - runBegin >= LUBELOAD_SECONDS * 1000000ULL) {
+        loadReport(now) ;
+        exit(EXIT_SUCCESS) ;
+    }
+    mechDeferToStepEnd(loadStep) ;
+}
+
+/*
+ * EXTERNAL FUNCTION DEFINITIONS
+ */
+
+/*
+ * External operations that the test harness otherwise provides.
+ */
+void
+eop_lube_UI_Deactivated(InstId_t sessionId)
+{
+}
+
+void
+eop_lube_App_Error(char const *Msg)
+{
+}
+
+void
+eop_lube_SIO_Inject(InstId_t injectorId)
+{
+}
+
+void
+eop_lube_SIO_Stop_injecting(InstId_t injectorId)
+{
+}
+
+void
+eop_lube_SIO_Start_monitoring(InstId_t injectorId)
+{
+}
+
+void
+eop_lube_SIO_Stop_monitoring(InstId_t injectorId)
+{
+}
+
+void
+eop_lube_ALARM_Set_pressure_error(InstId_t injectorId)
+{
+}
+
+void
+eop_lube_ALARM_Set_dissipation_error(InstId_t injectorId)
+{
+}
+
+void
+eop_lube_ALARM_Clear_dissipation_error(InstId_t injectorId)
+{
+}
+
+void
+eop_lube_ALARM_Set_lube_level_very_low(InstId_t reservoirId)
+{
+}
+
+void
+eop_lube_ALARM_Clear_lube_level_very_low(InstId_t reservoirId)
+{
+}
+
+void
+eop_lube_ALARM_Set_lube_level_low(InstId_t reservoirId)
+{
+}
+
+void
+eop_lube_ALARM_Clear_lube_level_low(InstId_t reservoirId)
+{
+}
+
+void
+eop_lube_ALARM_Set_lube_level_empty(InstId_t reservoirId)
+{
+}
+
+void
+eop_lube_ALARM_Clear_lube_level_empty(InstId_t reservoirId)
+{
+}
+
+void
+sysDeviceInit(void)
+{
+}
+
+void
+sysDomainInit(void)
+{
+    sessionCount = lube_Load_population() ;
+    lube_init() ;
+    mechDeferToStepEnd(loadStep) ;
+}
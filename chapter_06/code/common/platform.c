@@ -12,10 +12,15 @@
 /*
  * INCLUDE FILES
  */
+#include <stdio.h>
+#include <stdlib.h>
 #include "harness.h"
 #include "mechs.h"
 #include "lube.h"
 #include "lubeharness.h"
+#ifdef MECH_JOURNAL
+#   include "mechsJournal.h"
+#endif /* MECH_JOURNAL */
 
 /*
  * MACRO DEFINITIONS
@@ -57,6 +62,25 @@ void
 sysDomainInit(void)
 {
     lube_init() ;
+#   ifdef MECH_JOURNAL
+    /*
+     * Journaling is requested by setting LUBE_JOURNAL in the environment
+     * to the base name of the journal files. The state of the domain is
+     * then recovered from any previous run that used the same files.
+     * The journal keeps the file names, so they must be static.
+     */
+    char const *journalBase = getenv("LUBE_JOURNAL") ;
+    if (journalBase != NULL && *journalBase != '\0') {
+        static char logPath[FILENAME_MAX] ;
+        static char ckptPath[FILENAME_MAX] ;
+        snprintf(logPath, sizeof(logPath), "%s.journal", journalBase) ;
+        snprintf(ckptPath, sizeof(ckptPath), "%s.checkpoint", journalBase) ;
+        if (mechJournalRegisterPortal(&lube_portal) == 0 &&
+                mechJournalOpen(logPath, ckptPath) == 0) {
+            mechJournalRecover() ;
+        }
+    }
+#   endif /* MECH_JOURNAL */
     harness_init() ;
     lube_harness_init() ;
 }
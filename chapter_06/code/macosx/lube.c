@@ -215,6 +215,7 @@
     #include <assert.h>
     #include <time.h>
     #include <string.h>
+    #include "mechsIndex.h"
     #include "lube.h"
     typedef uint32_t Seconds ;
     typedef uint32_t Duration ;
@@ -227,6 +228,18 @@
         FS_verylow,
         FS_empty
     } Fluid_State ;
+    // Index of Lubrication Schedule names built by the "init" domain operation.
+    static struct mechindex scheduleIndex ;
+    /*
+     * Autocycle Sessions are started a batch at a time at initialization.
+     * These are the next allocated session to start and the last session
+     * of the batch most recently started.
+     */
+#   ifndef LUBE_STARTUP_BATCH
+#       define LUBE_STARTUP_BATCH   8
+#   endif /* LUBE_STARTUP_BATCH */
+    static MechInstance startingSession ;
+    static struct Autocycle_Session *lastStarted ;
     /*
      * To speed testing along, we will scale the time. When converting from
      * seconds to milliseconds in dealing with delayed events, we will us a
@@ -243,6 +256,16 @@
 #   define SecsToDelayTime(s)   ((s) * 1000UL)
 #   define DelayTimeToSecs(d)   ((d) / 1000UL)
 #endif /* INSTRUMENT */
+    /*
+     * Suspending a delayed event holds it aside with its remaining time
+     * until it is resumed.
+     */
+#   define SuspendDelayedToSelf(e)\
+        mechEventDelaySuspend(EventNumber(THISCLASS__, e),\
+                (MechInstance)self, (MechInstance)self)
+#   define ResumeDelayedToSelf(e)\
+        mechEventDelayResume(EventNumber(THISCLASS__, e),\
+                (MechInstance)self, (MechInstance)self)
 
 
 #ifdef INSTRUMENT
@@ -495,6 +518,7 @@ static struct Lubrication_Schedule * Lubrication_Schedule_findByName(char const
 static void Injector_Max_system_pressure(struct Injector *self) ;
 static void Autocycle_Session_Deactivate(struct Autocycle_Session *self) ;
 static void Autocycle_Session_Suspend(struct Autocycle_Session *self) ;
+static void Autocycle_Session_startSessions(void) ;
 static void Machinery_Unlock(struct Machinery *self) ;
 static void Machinery_Lock(struct Machinery *self) ;
 
@@ -1348,6 +1372,31 @@ static void Autocycle_Session_Suspend(struct Autocycle_Session *self)
     self->Suspend_requested = true ;
     PYCCA_generateToSelf(Suspend) ;
 }
+static void Autocycle_Session_startSessions(void)
+{
+    INSTR_FUNC("lube.Autocycle_Session.startSessions") ;
+
+    if (lastStarted != NULL && IsInstInUse(lastStarted) &&
+            lastStarted->common_.currentState ==
+                StateNumber(Autocycle_Session, Creating)) {
+        mechDeferToStepEnd(ClassOp(Autocycle_Session, startSessions)) ;
+        return ;
+    }
+
+    unsigned started = 0 ;
+    while (startingSession != NULL && started < LUBE_STARTUP_BATCH) {
+        ClassRefVar(Autocycle_Session, acs) =
+                (struct Autocycle_Session *)startingSession ;
+        startingSession = mechInstNextAllocated(startingSession) ;
+        PYCCA_generate(Created, Autocycle_Session, acs, NULL) ;
+        lastStarted = acs ;
+        ++started ;
+    }
+
+    if (startingSession != NULL) {
+        mechDeferToStepEnd(ClassOp(Autocycle_Session, startSessions)) ;
+    }
+}
 #undef THISCLASS__
 #define THISCLASS__ Injector
 static void Injector_Max_system_pressure(struct Injector *self)
@@ -1364,9 +1413,7 @@ static struct Lubrication_Schedule * Lubrication_Schedule_findByName(char const
 {
     INSTR_FUNC("lube.Lubrication_Schedule.findByName") ;
 
-    ThisClassRefVar(ls) ;
-    PYCCA_selectOneStaticInstOfThisClassWhere(ls, strcmp(ls->Name, name) == 0)
-    return ls == ThisClassEndStorage ? NULL : ls ;
+    return mechIndexFind(&scheduleIndex, name) ;
 }
 #undef THISCLASS__
 #define THISCLASS__ Machinery
@@ -1481,6 +1528,10 @@ static void Autocycle_Session_NOT_ACTIVE(void *const s_, void *const p_)
     INSTR_FUNC("lube.Autocycle_Session.NOT_ACTIVE") ;
     struct Autocycle_Session *const self = (struct Autocycle_Session *)s_ ;
 
+    /*
+     * Deactivating a suspended session discards the interval it held.
+     */
+    PYCCA_cancelDelayedToSelf(Get_ready_to_lubricate) ;
     ExternalOp(UI_Deactivated)(PYCCA_idOfSelf) ;
 
     ClassRefVar(Lubrication_Schedule, ls) = self->R2_LBS ;
@@ -1501,8 +1552,10 @@ static void Autocycle_Session_WAIT_INTERVAL(void *const s_, void *const p_)
     if (self->Deactivate) {
         PYCCA_generateToSelf(Deactivate) ;
     } else {
-        PYCCA_generateDelayedToSelf(Get_ready_to_lubricate,
-            SecsToDelayTime(self->Wait_time_remaining)) ;
+        if (!ResumeDelayedToSelf(Get_ready_to_lubricate)) {
+            PYCCA_generateDelayedToSelf(Get_ready_to_lubricate,
+                SecsToDelayTime(self->Wait_time_remaining)) ;
+        }
         if (self->Suspend_requested) {
             PYCCA_generateToSelf(Suspend) ;
         }
@@ -1526,8 +1579,7 @@ static void Autocycle_Session_WAIT_SUSPENDED(void *const s_, void *const p_)
     struct Autocycle_Session *const self = (struct Autocycle_Session *)s_ ;
 
     self->Wait_time_remaining =
-            DelayTimeToSecs(PYCCA_remainDelayedToSelf(Get_ready_to_lubricate)) ;
-    PYCCA_cancelDelayedToSelf(Get_ready_to_lubricate) ;
+            DelayTimeToSecs(SuspendDelayedToSelf(Get_ready_to_lubricate)) ;
     self->Suspend_requested = false ;
 #undef THISSTATE__
 }
@@ -1840,12 +1892,23 @@ void lube_init(void)
 {
     INSTR_FUNC("lube.init") ;
 
-    ClassRefVar(Autocycle_Session, acs) ;
-    PYCCA_forAllInst(acs, Autocycle_Session) {
-        if (IsInstInUse(acs)) {
-            PYCCA_generate(Created, Autocycle_Session, acs, NULL) ;
-        }
-    }
+    static MechIndexSlot scheduleBuckets[
+            MECH_INDEX_BUCKETS(COUNTOF(BeginStorage(Lubrication_Schedule)))] ;
+    scheduleIndex = (struct mechindex) {
+        .storageStart = BeginStorage(Lubrication_Schedule),
+        .instanceSize = sizeof(struct Lubrication_Schedule),
+        .instanceCount = COUNTOF(BeginStorage(Lubrication_Schedule)),
+        .keyOffset = offsetof(struct Lubrication_Schedule, Name),
+        .keyType = MechKeyStringRef,
+        .hasCommon = false,
+        .buckets = scheduleBuckets,
+        .bucketCount = COUNTOF(scheduleBuckets),
+    } ;
+    mechIndexInit(&scheduleIndex) ;
+
+    startingSession = mechInstFirstAllocated(ClassData(Autocycle_Session)) ;
+    lastStarted = NULL ;
+    ClassOp(Autocycle_Session, startSessions)() ;
 }
 void lube_Suspend_Autocycle_Session(InstId_t sessionId)
 {
@@ -0,0 +1,178 @@
+/*
+ *++
+ * PROJECT:
+ *  Models to Code Book
+ *
+ * MODULE:
+ *  periodictest.c -- periodic event deadline test
+ *
+ * ABSTRACT:
+ *  Checks the deadlines of a periodic event when it is dispatched on
+ *  time and when it is dispatched a whole number of periods late. A
+ *  virtual clock is set before each dispatch to the time at which the
+ *  dispatch is to appear to happen. After a dispatch that is one or more
+ *  whole periods late, the next deadline falls due at once, so the event
+ *  must be queued for dispatch without a delay rather than being timed.
+ *  The result is reported and the program exits.
+ *
+ *--
+ */
+
+/*
+ * INCLUDE FILES
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mechs.h"
+
+/*
+ * MACRO DEFINITIONS
+ */
+#define PERIODIC_PERIOD         20
+#define PERIODIC_TICK           0
+
+#define COUNTOF(a)              (sizeof(a) / sizeof(a[0]))
+
+/*
+ * TYPE DEFINITIONS
+ */
+struct ticker {
+    struct mechinstance common_ ;
+    unsigned ticks ;
+} ;
+
+/*
+ * The virtual time, in milliseconds, at which each tick is dispatched,
+ * the periods missed before it and whether the tick that follows is to
+ * be queued at once.
+ */
+struct tickplan {
+    MechTime at ;
+    unsigned long missed ;
+    bool queued ;
+} ;
+
+/*
+ * FORWARD FUNCTION DECLARATIONS
+ */
+static void tickerTick(void *const, void *const) ;
+
+/*
+ * STATIC DATA DEFINITIONS
+ */
+static struct ticker ticker ;
+
+/*
+ * One state with one event that transitions back to it.
+ */
+static StateCode const tickerTransitions[] = { 0 } ;
+static PtrActionFunction const tickerActions[] = { tickerTick } ;
+
+static struct objectdispatchblock const tickerDispatch = {
+    .stateCount = 1,
+    .eventCount = 1,
+    .transitionTable = tickerTransitions,
+    .actionTable = tickerActions,
+} ;
+
+static struct mechclass const tickerClass = {
+    .odb = &tickerDispatch,
+} ;
+
+/*
+ * The event is first due at one period. The second tick is one period
+ * late and the fourth two periods late, so the third and fifth fall due
+ * at the time of the tick before them. The period between the deadlines
+ * of the fourth and fifth ticks is missed.
+ */
+static struct tickplan const plan[] = {
+    { 1 * PERIODIC_PERIOD, 0, false },
+    { 3 * PERIODIC_PERIOD, 0, true },
+    { 3 * PERIODIC_PERIOD, 0, false },
+    { 6 * PERIODIC_PERIOD, 0, true },
+    { 6 * PERIODIC_PERIOD, 1, false },
+    { 7 * PERIODIC_PERIOD, 1, false },
+} ;
+
+static MechTime virtualTime ;
+static unsigned failures ;
+
+/*
+ * STATIC FUNCTION DEFINITIONS
+ */
+static MechTime
+virtualNow(void)
+{
+    return virtualTime ;
+}
+
+static void
+tickCheck(
+    bool ok,
+    char const *what)
+{
+    printf("periodictest: tick %u: %s: %s\n", ticker.ticks, what,
+            ok ? "ok" : "FAILED") ;
+    if (!ok) {
+        ++failures ;
+    }
+}
+
+/*
+ * Run at the end of the step of each tick, once the event has been
+ * posted for its next period.
+ */
+static void
+tickPosted(void)
+{
+    struct tickplan const *tick = plan + ticker.ticks - 1 ;
+    MechDelayTime remain = mechEventDelayRemaining(PERIODIC_TICK,
+            &ticker.common_, &ticker.common_) ;
+    tickCheck(tick->queued ? remain == 0 : remain != 0,
+            tick->queued ? "next tick queued at once" : "next tick timed") ;
+}
+
+/*
+ * The action of the ticker class. It checks the tick against the plan and
+ * sets the clock for the next one.
+ */
+static void
+tickerTick(
+    void *const s,
+    void *const p)
+{
+    struct ticker *const self = s ;
+    struct tickplan const *tick = plan + self->ticks++ ;
+
+    tickCheck(mechNow() / 1000 == tick->at, "dispatched at its time") ;
+    tickCheck(mechGetStats()->periodsMissed == tick->missed,
+            "periods missed") ;
+
+    if (self->ticks == COUNTOF(plan)) {
+        printf("periodictest: %s\n", failures == 0 ? "PASSED" : "FAILED") ;
+        exit(failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE) ;
+    }
+    virtualTime = tick[1].at * 1000 ;
+    mechDeferToStepEnd(tickPosted) ;
+}
+
+/*
+ * EXTERNAL FUNCTION DEFINITIONS
+ */
+void
+sysDeviceInit(void)
+{
+}
+
+void
+sysDomainInit(void)
+{
+    ticker.common_.alloc = 1 ;
+    ticker.common_.currentState = 0 ;
+    ticker.common_.instClass = &tickerClass ;
+
+    mechSetTimeSource(virtualNow) ;
+    mechEventGeneratePeriodicToSelf(PERIODIC_TICK, &ticker.common_,
+            PERIODIC_PERIOD) ;
+    virtualTime = plan[0].at * 1000 ;
+}
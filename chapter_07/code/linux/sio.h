@@ -146,7 +146,13 @@ extern void eop_sio_DEVICE_Disable_signal(sio_Point_ID pid) ;
 #define SIO_CONTINUOUS_INPUT_POINT_IOP3_INST_ID 2
 #define SIO_CONTINUOUS_INPUT_POINT_INST_COUNT    11
 #define SIO_CONTINUOUS_INPUT_POINT_VALUE_ATTR_ID    0
-#define SIO_CONTINUOUS_INPUT_POINT_ATTR_COUNT 1
+#define SIO_CONTINUOUS_INPUT_POINT_NOTIFY_INTERVAL_ATTR_ID    1
+#define SIO_CONTINUOUS_INPUT_POINT_NOTIFIED_VALUE_ATTR_ID    2
+#define SIO_CONTINUOUS_INPUT_POINT_NOTIFIED_AT_ATTR_ID    3
+#define SIO_CONTINUOUS_INPUT_POINT_NOTIFIED_ATTR_ID    4
+#define SIO_CONTINUOUS_INPUT_POINT_FORWARDED_COUNT_ATTR_ID    5
+#define SIO_CONTINUOUS_INPUT_POINT_SUPPRESSED_COUNT_ATTR_ID    6
+#define SIO_CONTINUOUS_INPUT_POINT_ATTR_COUNT 7
 /*
  * Class: Point_Scaling
  */
@@ -158,7 +164,8 @@ extern void eop_sio_DEVICE_Disable_signal(sio_Point_ID pid) ;
 #define SIO_POINT_SCALING_DIVISOR_ATTR_ID    1
 #define SIO_POINT_SCALING_INTERCEPT_ATTR_ID    2
 #define SIO_POINT_SCALING_MASK_ATTR_ID    3
-#define SIO_POINT_SCALING_ATTR_COUNT 4
+#define SIO_POINT_SCALING_DEADBAND_ATTR_ID    4
+#define SIO_POINT_SCALING_ATTR_COUNT 5
 /*
  * Class: Point_Threshold
  */
@@ -189,12 +196,9 @@ extern void eop_sio_DEVICE_Disable_signal(sio_Point_ID pid) ;
 #define SIO_RANGE_LIMITATION_ABOVE_INJ_IOP3_INST_ID 7
 #define SIO_RANGE_LIMITATION_MAX_PRES_IOP3_INST_ID 8
 #define SIO_RANGE_LIMITATION_INST_COUNT    9
-#define SIO_RANGE_LIMITATION_OVER_COUNT_ATTR_ID    0
-#define SIO_RANGE_LIMITATION_UNDER_COUNT_ATTR_ID    1
-#define SIO_RANGE_LIMITATION_ATTR_COUNT 2
+#define SIO_RANGE_LIMITATION_ATTR_COUNT 0
 #define SIO_RANGE_LIMITATION_IN_RANGE_EVENT_ID 0
-#define SIO_RANGE_LIMITATION_NEW_POINT_EVENT_ID 1
-#define SIO_RANGE_LIMITATION_OUT_OF_RANGE_EVENT_ID 2
+#define SIO_RANGE_LIMITATION_OUT_OF_RANGE_EVENT_ID 1
 /*
  * Class: Signal_Converter
  */
@@ -202,7 +206,11 @@ extern void eop_sio_DEVICE_Disable_signal(sio_Point_ID pid) ;
 #define SIO_SIGNAL_CONVERTER_CVT1_INST_ID 0
 #define SIO_SIGNAL_CONVERTER_INST_COUNT    1
 #define SIO_SIGNAL_CONVERTER_CONVERTER_AVAILABLE_ATTR_ID    0
-#define SIO_SIGNAL_CONVERTER_ATTR_COUNT 1
+#define SIO_SIGNAL_CONVERTER_CONVERSION_COUNT_ATTR_ID    1
+#define SIO_SIGNAL_CONVERTER_BUSY_TIME_ATTR_ID    2
+#define SIO_SIGNAL_CONVERTER_IDLE_TIME_ATTR_ID    3
+#define SIO_SIGNAL_CONVERTER_CHANGED_AT_ATTR_ID    4
+#define SIO_SIGNAL_CONVERTER_ATTR_COUNT 5
 #define SIO_SIGNAL_CONVERTER_CONVERSION_DONE_EVENT_ID 0
 #define SIO_SIGNAL_CONVERTER_CONVERTER_ASSIGNED_EVENT_ID 1
 /*
@@ -215,7 +223,16 @@ extern void eop_sio_DEVICE_Disable_signal(sio_Point_ID pid) ;
 #define SIO_CONVERSION_GROUP_INST_COUNT    3
 #define SIO_CONVERSION_GROUP_WAITING_FOR_CONVERTER_ATTR_ID    0
 #define SIO_CONVERSION_GROUP_PERIOD_ATTR_ID    1
-#define SIO_CONVERSION_GROUP_ATTR_COUNT 2
+#define SIO_CONVERSION_GROUP_SCHEDULED_ATTR_ID    2
+#define SIO_CONVERSION_GROUP_SAMPLE_PENDING_ATTR_ID    3
+#define SIO_CONVERSION_GROUP_NEXT_SAMPLE_ATTR_ID    4
+#define SIO_CONVERSION_GROUP_SAMPLE_COUNT_ATTR_ID    5
+#define SIO_CONVERSION_GROUP_OVERRUN_COUNT_ATTR_ID    6
+#define SIO_CONVERSION_GROUP_MAX_JITTER_ATTR_ID    7
+#define SIO_CONVERSION_GROUP_READY_AT_ATTR_ID    8
+#define SIO_CONVERSION_GROUP_WAIT_TIME_ATTR_ID    9
+#define SIO_CONVERSION_GROUP_MAX_WAIT_ATTR_ID    10
+#define SIO_CONVERSION_GROUP_ATTR_COUNT 11
 #define SIO_CONVERSION_GROUP_CONVERSION_DONE_EVENT_ID 0
 #define SIO_CONVERSION_GROUP_SAMPLE_EVENT_ID 1
 #define SIO_CONVERSION_GROUP_STOP_EVENT_ID 2
@@ -229,8 +246,30 @@ extern void eop_sio_DEVICE_Disable_signal(sio_Point_ID pid) ;
 #define SIO_R6_ASSIGNER_CONVERTER_ASSIGNED_EVENT_ID 0
 #define SIO_R6_ASSIGNER_CONVERTER_READY_EVENT_ID 1
 #define SIO_R6_ASSIGNER_GROUP_READY_EVENT_ID 2
+/*
+ * Class: Debounce_Scanner
+ */
+#define SIO_DEBOUNCE_SCANNER_CLASS_ID     13
+#define SIO_DEBOUNCE_SCANNER_DBSCAN1_INST_ID 0
+#define SIO_DEBOUNCE_SCANNER_INST_COUNT    1
+#define SIO_DEBOUNCE_SCANNER_ATTR_COUNT 0
+#define SIO_DEBOUNCE_SCANNER_CONTINUE_EVENT_ID 0
+#define SIO_DEBOUNCE_SCANNER_SCAN_EVENT_ID 1
+#define SIO_DEBOUNCE_SCANNER_START_EVENT_ID 2
+#define SIO_DEBOUNCE_SCANNER_STOP_EVENT_ID 3
+/*
+ * Class: Sampling_Scheduler
+ */
+#define SIO_SAMPLING_SCHEDULER_CLASS_ID     14
+#define SIO_SAMPLING_SCHEDULER_SMPSCHED1_INST_ID 0
+#define SIO_SAMPLING_SCHEDULER_INST_COUNT    1
+#define SIO_SAMPLING_SCHEDULER_ATTR_COUNT 0
+#define SIO_SAMPLING_SCHEDULER_CONTINUE_EVENT_ID 0
+#define SIO_SAMPLING_SCHEDULER_START_EVENT_ID 1
+#define SIO_SAMPLING_SCHEDULER_STOP_EVENT_ID 2
+#define SIO_SAMPLING_SCHEDULER_TICK_EVENT_ID 3
 
-#define SIO_CLASS_COUNT 13
+#define SIO_CLASS_COUNT 15
 /*
  * Data Portal Access Variable
  */
@@ -69,6 +69,16 @@ static bool sio_Control_Point_Access_read(struct pycca_domain_portal const *port
 static bool sio_Control_Point_Access_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
 static bool sio_Continuous_Input_Point_Value_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
 static bool sio_Continuous_Input_Point_Value_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Continuous_Input_Point_Notify_interval_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Continuous_Input_Point_Notify_interval_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Continuous_Input_Point_Notified_value_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Continuous_Input_Point_Notified_value_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Continuous_Input_Point_Notified_at_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Continuous_Input_Point_Notified_at_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Continuous_Input_Point_Forwarded_count_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Continuous_Input_Point_Forwarded_count_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Continuous_Input_Point_Suppressed_count_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Continuous_Input_Point_Suppressed_count_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
 static bool sio_Point_Scaling_Multiplier_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
 static bool sio_Point_Scaling_Multiplier_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
 static bool sio_Point_Scaling_Divisor_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
@@ -77,6 +87,8 @@ static bool sio_Point_Scaling_Intercept_read(struct pycca_domain_portal const *p
 static bool sio_Point_Scaling_Intercept_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
 static bool sio_Point_Scaling_Mask_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
 static bool sio_Point_Scaling_Mask_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Point_Scaling_Deadband_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Point_Scaling_Deadband_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
 static bool sio_Point_Threshold_Limit_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
 static bool sio_Point_Threshold_Limit_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
 static bool sio_Point_Threshold_Direction_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
@@ -85,18 +97,39 @@ static bool sio_Point_Threshold_Over_limit_read(struct pycca_domain_portal const
 static bool sio_Point_Threshold_Over_limit_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
 static bool sio_Point_Threshold_Under_limit_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
 static bool sio_Point_Threshold_Under_limit_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
-static bool sio_Range_Limitation_Over_count_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
-static bool sio_Range_Limitation_Over_count_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
-static bool sio_Range_Limitation_Under_count_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
-static bool sio_Range_Limitation_Under_count_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
 static bool sio_Signal_Converter_Converter_available_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
 static bool sio_Signal_Converter_Converter_available_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Signal_Converter_Conversion_count_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Signal_Converter_Conversion_count_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Signal_Converter_Busy_time_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Signal_Converter_Busy_time_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Signal_Converter_Idle_time_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Signal_Converter_Idle_time_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Signal_Converter_Changed_at_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Signal_Converter_Changed_at_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
 static bool sio_Conversion_Group_Waiting_for_converter_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
 static bool sio_Conversion_Group_Waiting_for_converter_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
 static bool sio_Conversion_Group_Period_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
 static bool sio_Conversion_Group_Period_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Conversion_Group_Scheduled_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Conversion_Group_Scheduled_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Conversion_Group_Sample_pending_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Conversion_Group_Sample_pending_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Conversion_Group_Next_sample_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Conversion_Group_Next_sample_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Conversion_Group_Sample_count_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Conversion_Group_Sample_count_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Conversion_Group_Overrun_count_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Conversion_Group_Overrun_count_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Conversion_Group_Max_jitter_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Conversion_Group_Max_jitter_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Conversion_Group_Ready_at_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Conversion_Group_Ready_at_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Conversion_Group_Wait_time_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Conversion_Group_Wait_time_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
+static bool sio_Conversion_Group_Max_wait_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result) ;
+static bool sio_Conversion_Group_Max_wait_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result) ;
 
-static int sio_Range_Limitation_New_point_fmt(EventParamType *params, int argc, char const **argv) ;
 
 
 /*
@@ -109,6 +142,26 @@ static dop_map_t const sio_domain_op[] = {
 } ;
 
 static attr_map_t const sio_Continuous_Input_Point_attr_map[] = {
+    {.name = "Forwarded_count",
+     .id = SIO_CONTINUOUS_INPUT_POINT_FORWARDED_COUNT_ATTR_ID,
+     .attr_read = sio_Continuous_Input_Point_Forwarded_count_read,
+     .attr_update = sio_Continuous_Input_Point_Forwarded_count_update},
+    {.name = "Notified_at",
+     .id = SIO_CONTINUOUS_INPUT_POINT_NOTIFIED_AT_ATTR_ID,
+     .attr_read = sio_Continuous_Input_Point_Notified_at_read,
+     .attr_update = sio_Continuous_Input_Point_Notified_at_update},
+    {.name = "Notified_value",
+     .id = SIO_CONTINUOUS_INPUT_POINT_NOTIFIED_VALUE_ATTR_ID,
+     .attr_read = sio_Continuous_Input_Point_Notified_value_read,
+     .attr_update = sio_Continuous_Input_Point_Notified_value_update},
+    {.name = "Notify_interval",
+     .id = SIO_CONTINUOUS_INPUT_POINT_NOTIFY_INTERVAL_ATTR_ID,
+     .attr_read = sio_Continuous_Input_Point_Notify_interval_read,
+     .attr_update = sio_Continuous_Input_Point_Notify_interval_update},
+    {.name = "Suppressed_count",
+     .id = SIO_CONTINUOUS_INPUT_POINT_SUPPRESSED_COUNT_ATTR_ID,
+     .attr_read = sio_Continuous_Input_Point_Suppressed_count_read,
+     .attr_update = sio_Continuous_Input_Point_Suppressed_count_update},
     {.name = "Value",
      .id = SIO_CONTINUOUS_INPUT_POINT_VALUE_ATTR_ID,
      .attr_read = sio_Continuous_Input_Point_Value_read,
@@ -141,10 +194,46 @@ static inst_map_t const sio_Control_Point_inst_map[] = {
      .id = SIO_IO_POINT_IOP6_INST_ID},
 } ;
 static attr_map_t const sio_Conversion_Group_attr_map[] = {
+    {.name = "Max_jitter",
+     .id = SIO_CONVERSION_GROUP_MAX_JITTER_ATTR_ID,
+     .attr_read = sio_Conversion_Group_Max_jitter_read,
+     .attr_update = sio_Conversion_Group_Max_jitter_update},
+    {.name = "Max_wait",
+     .id = SIO_CONVERSION_GROUP_MAX_WAIT_ATTR_ID,
+     .attr_read = sio_Conversion_Group_Max_wait_read,
+     .attr_update = sio_Conversion_Group_Max_wait_update},
+    {.name = "Next_sample",
+     .id = SIO_CONVERSION_GROUP_NEXT_SAMPLE_ATTR_ID,
+     .attr_read = sio_Conversion_Group_Next_sample_read,
+     .attr_update = sio_Conversion_Group_Next_sample_update},
+    {.name = "Overrun_count",
+     .id = SIO_CONVERSION_GROUP_OVERRUN_COUNT_ATTR_ID,
+     .attr_read = sio_Conversion_Group_Overrun_count_read,
+     .attr_update = sio_Conversion_Group_Overrun_count_update},
     {.name = "Period",
      .id = SIO_CONVERSION_GROUP_PERIOD_ATTR_ID,
      .attr_read = sio_Conversion_Group_Period_read,
      .attr_update = sio_Conversion_Group_Period_update},
+    {.name = "Ready_at",
+     .id = SIO_CONVERSION_GROUP_READY_AT_ATTR_ID,
+     .attr_read = sio_Conversion_Group_Ready_at_read,
+     .attr_update = sio_Conversion_Group_Ready_at_update},
+    {.name = "Sample_count",
+     .id = SIO_CONVERSION_GROUP_SAMPLE_COUNT_ATTR_ID,
+     .attr_read = sio_Conversion_Group_Sample_count_read,
+     .attr_update = sio_Conversion_Group_Sample_count_update},
+    {.name = "Sample_pending",
+     .id = SIO_CONVERSION_GROUP_SAMPLE_PENDING_ATTR_ID,
+     .attr_read = sio_Conversion_Group_Sample_pending_read,
+     .attr_update = sio_Conversion_Group_Sample_pending_update},
+    {.name = "Scheduled",
+     .id = SIO_CONVERSION_GROUP_SCHEDULED_ATTR_ID,
+     .attr_read = sio_Conversion_Group_Scheduled_read,
+     .attr_update = sio_Conversion_Group_Scheduled_update},
+    {.name = "Wait_time",
+     .id = SIO_CONVERSION_GROUP_WAIT_TIME_ATTR_ID,
+     .attr_read = sio_Conversion_Group_Wait_time_read,
+     .attr_update = sio_Conversion_Group_Wait_time_update},
     {.name = "Waiting_for_converter",
      .id = SIO_CONVERSION_GROUP_WAITING_FOR_CONVERTER_ATTR_ID,
      .attr_read = sio_Conversion_Group_Waiting_for_converter_read,
@@ -172,6 +261,28 @@ static event_map_t const sio_Conversion_Group_event_map[] = {
      .paramFmt = NULL,
      .pcount = 0},
 } ;
+static inst_map_t const sio_Debounce_Scanner_inst_map[] = {
+    {.name = "dbscan1",
+     .id = SIO_DEBOUNCE_SCANNER_DBSCAN1_INST_ID},
+} ;
+static event_map_t const sio_Debounce_Scanner_event_map[] = {
+    {.name = "Continue",
+     .id = SIO_DEBOUNCE_SCANNER_CONTINUE_EVENT_ID,
+     .paramFmt = NULL,
+     .pcount = 0},
+    {.name = "Scan",
+     .id = SIO_DEBOUNCE_SCANNER_SCAN_EVENT_ID,
+     .paramFmt = NULL,
+     .pcount = 0},
+    {.name = "Start",
+     .id = SIO_DEBOUNCE_SCANNER_START_EVENT_ID,
+     .paramFmt = NULL,
+     .pcount = 0},
+    {.name = "Stop",
+     .id = SIO_DEBOUNCE_SCANNER_STOP_EVENT_ID,
+     .paramFmt = NULL,
+     .pcount = 0},
+} ;
 static attr_map_t const sio_Packed_Point_attr_map[] = {
     {.name = "Length",
      .id = SIO_PACKED_POINT_LENGTH_ATTR_ID,
@@ -183,6 +294,10 @@ static attr_map_t const sio_Packed_Point_attr_map[] = {
      .attr_update = sio_Packed_Point_Offset_update},
 } ;
 static attr_map_t const sio_Point_Scaling_attr_map[] = {
+    {.name = "Deadband",
+     .id = SIO_POINT_SCALING_DEADBAND_ATTR_ID,
+     .attr_read = sio_Point_Scaling_Deadband_read,
+     .attr_update = sio_Point_Scaling_Deadband_update},
     {.name = "Divisor",
      .id = SIO_POINT_SCALING_DIVISOR_ATTR_ID,
      .attr_read = sio_Point_Scaling_Divisor_read,
@@ -256,16 +371,6 @@ static event_map_t const sio_R6_Assigner_event_map[] = {
      .paramFmt = NULL,
      .pcount = 0},
 } ;
-static attr_map_t const sio_Range_Limitation_attr_map[] = {
-    {.name = "Over_count",
-     .id = SIO_RANGE_LIMITATION_OVER_COUNT_ATTR_ID,
-     .attr_read = sio_Range_Limitation_Over_count_read,
-     .attr_update = sio_Range_Limitation_Over_count_update},
-    {.name = "Under_count",
-     .id = SIO_RANGE_LIMITATION_UNDER_COUNT_ATTR_ID,
-     .attr_read = sio_Range_Limitation_Under_count_read,
-     .attr_update = sio_Range_Limitation_Under_count_update},
-} ;
 static inst_map_t const sio_Range_Limitation_inst_map[] = {
     {.name = "above_disp_iop1",
      .id = SIO_RANGE_LIMITATION_ABOVE_DISP_IOP1_INST_ID},
@@ -291,20 +396,54 @@ static event_map_t const sio_Range_Limitation_event_map[] = {
      .id = SIO_RANGE_LIMITATION_IN_RANGE_EVENT_ID,
      .paramFmt = NULL,
      .pcount = 0},
-    {.name = "New_point",
-     .id = SIO_RANGE_LIMITATION_NEW_POINT_EVENT_ID,
-     .paramFmt = sio_Range_Limitation_New_point_fmt,
-     .pcount = 1},
     {.name = "Out_of_range",
      .id = SIO_RANGE_LIMITATION_OUT_OF_RANGE_EVENT_ID,
      .paramFmt = NULL,
      .pcount = 0},
 } ;
+static inst_map_t const sio_Sampling_Scheduler_inst_map[] = {
+    {.name = "smpsched1",
+     .id = SIO_SAMPLING_SCHEDULER_SMPSCHED1_INST_ID},
+} ;
+static event_map_t const sio_Sampling_Scheduler_event_map[] = {
+    {.name = "Continue",
+     .id = SIO_SAMPLING_SCHEDULER_CONTINUE_EVENT_ID,
+     .paramFmt = NULL,
+     .pcount = 0},
+    {.name = "Start",
+     .id = SIO_SAMPLING_SCHEDULER_START_EVENT_ID,
+     .paramFmt = NULL,
+     .pcount = 0},
+    {.name = "Stop",
+     .id = SIO_SAMPLING_SCHEDULER_STOP_EVENT_ID,
+     .paramFmt = NULL,
+     .pcount = 0},
+    {.name = "Tick",
+     .id = SIO_SAMPLING_SCHEDULER_TICK_EVENT_ID,
+     .paramFmt = NULL,
+     .pcount = 0},
+} ;
 static attr_map_t const sio_Signal_Converter_attr_map[] = {
+    {.name = "Busy_time",
+     .id = SIO_SIGNAL_CONVERTER_BUSY_TIME_ATTR_ID,
+     .attr_read = sio_Signal_Converter_Busy_time_read,
+     .attr_update = sio_Signal_Converter_Busy_time_update},
+    {.name = "Changed_at",
+     .id = SIO_SIGNAL_CONVERTER_CHANGED_AT_ATTR_ID,
+     .attr_read = sio_Signal_Converter_Changed_at_read,
+     .attr_update = sio_Signal_Converter_Changed_at_update},
+    {.name = "Conversion_count",
+     .id = SIO_SIGNAL_CONVERTER_CONVERSION_COUNT_ATTR_ID,
+     .attr_read = sio_Signal_Converter_Conversion_count_read,
+     .attr_update = sio_Signal_Converter_Conversion_count_update},
     {.name = "Converter_available",
      .id = SIO_SIGNAL_CONVERTER_CONVERTER_AVAILABLE_ATTR_ID,
      .attr_read = sio_Signal_Converter_Converter_available_read,
      .attr_update = sio_Signal_Converter_Converter_available_update},
+    {.name = "Idle_time",
+     .id = SIO_SIGNAL_CONVERTER_IDLE_TIME_ATTR_ID,
+     .attr_read = sio_Signal_Converter_Idle_time_read,
+     .attr_update = sio_Signal_Converter_Idle_time_update},
 } ;
 static inst_map_t const sio_Signal_Converter_inst_map[] = {
     {.name = "cvt1",
@@ -372,7 +511,7 @@ static class_map_t const sio_class_map[] = {
     {.name = "Continuous_Input_Point",
      .id = SIO_CONTINUOUS_INPUT_POINT_CLASS_ID,
      .attrs = sio_Continuous_Input_Point_attr_map,
-     .attr_count = 1,
+     .attr_count = 6,
      .insts = sio_Continuous_Input_Point_inst_map,
      .inst_count = 3,
      .events = NULL,
@@ -392,13 +531,23 @@ static class_map_t const sio_class_map[] = {
     {.name = "Conversion_Group",
      .id = SIO_CONVERSION_GROUP_CLASS_ID,
      .attrs = sio_Conversion_Group_attr_map,
-     .attr_count = 2,
+     .attr_count = 11,
      .insts = sio_Conversion_Group_inst_map,
      .inst_count = 3,
      .events = sio_Conversion_Group_event_map,
      .event_count = 3,
      .polyevents = NULL,
      .polyevent_count = 0},
+    {.name = "Debounce_Scanner",
+     .id = SIO_DEBOUNCE_SCANNER_CLASS_ID,
+     .attrs = NULL,
+     .attr_count = 0,
+     .insts = sio_Debounce_Scanner_inst_map,
+     .inst_count = 1,
+     .events = sio_Debounce_Scanner_event_map,
+     .event_count = 4,
+     .polyevents = NULL,
+     .polyevent_count = 0},
     {.name = "Packed_Point",
      .id = SIO_PACKED_POINT_CLASS_ID,
      .attrs = sio_Packed_Point_attr_map,
@@ -412,7 +561,7 @@ static class_map_t const sio_class_map[] = {
     {.name = "Point_Scaling",
      .id = SIO_POINT_SCALING_CLASS_ID,
      .attrs = sio_Point_Scaling_attr_map,
-     .attr_count = 4,
+     .attr_count = 5,
      .insts = sio_Point_Scaling_inst_map,
      .inst_count = 2,
      .events = NULL,
@@ -441,18 +590,28 @@ static class_map_t const sio_class_map[] = {
      .polyevent_count = 0},
     {.name = "Range_Limitation",
      .id = SIO_RANGE_LIMITATION_CLASS_ID,
-     .attrs = sio_Range_Limitation_attr_map,
-     .attr_count = 2,
+     .attrs = NULL,
+     .attr_count = 0,
      .insts = sio_Range_Limitation_inst_map,
      .inst_count = 9,
      .events = sio_Range_Limitation_event_map,
-     .event_count = 3,
+     .event_count = 2,
+     .polyevents = NULL,
+     .polyevent_count = 0},
+    {.name = "Sampling_Scheduler",
+     .id = SIO_SAMPLING_SCHEDULER_CLASS_ID,
+     .attrs = NULL,
+     .attr_count = 0,
+     .insts = sio_Sampling_Scheduler_inst_map,
+     .inst_count = 1,
+     .events = sio_Sampling_Scheduler_event_map,
+     .event_count = 4,
      .polyevents = NULL,
      .polyevent_count = 0},
     {.name = "Signal_Converter",
      .id = SIO_SIGNAL_CONVERTER_CLASS_ID,
      .attrs = sio_Signal_Converter_attr_map,
-     .attr_count = 1,
+     .attr_count = 5,
      .insts = sio_Signal_Converter_inst_map,
      .inst_count = 1,
      .events = sio_Signal_Converter_event_map,
@@ -749,24 +908,24 @@ static bool sio_Continuous_Input_Point_Value_read(struct pycca_domain_portal con
     return retvalue ;
 }
 
-static bool sio_Point_Scaling_Multiplier_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+static bool sio_Continuous_Input_Point_Notify_interval_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
 
-    int32_t value = (int32_t)0 ;
+    uint32_t value = (uint32_t)0 ;
     int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
         snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
         retvalue = true ;
     }
     *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Point_Scaling_Divisor_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+static bool sio_Continuous_Input_Point_Notified_value_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
 
@@ -783,375 +942,764 @@ static bool sio_Point_Scaling_Divisor_read(struct pycca_domain_portal const *por
     return retvalue ;
 }
 
-static bool sio_Point_Scaling_Intercept_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+static bool sio_Continuous_Input_Point_Notified_at_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
 
-    int32_t value = (int32_t)0 ;
+    uint32_t value = (uint32_t)0 ;
     int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
         snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
         retvalue = true ;
     }
     *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Point_Scaling_Mask_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+static bool sio_Continuous_Input_Point_Forwarded_count_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
 
-    int32_t value = (int32_t)0 ;
+    int value = (int)0 ;
     int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
         snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
         retvalue = true ;
     }
     *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Point_Threshold_Limit_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+static bool sio_Continuous_Input_Point_Suppressed_count_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
 
-    int32_t value = (int32_t)0 ;
+    int value = (int)0 ;
     int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
         snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
         retvalue = true ;
     }
     *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Point_Threshold_Direction_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+static bool sio_Point_Scaling_Multiplier_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
 
-    uint8_t value = (uint8_t)0 ;
+    int32_t value = (int32_t)0 ;
     int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
         snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu8, value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
         retvalue = true ;
     }
     *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Point_Threshold_Over_limit_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+static bool sio_Point_Scaling_Divisor_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
 
-    int value = (int)0 ;
+    int32_t value = (int32_t)0 ;
     int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
         snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
         retvalue = true ;
     }
     *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Point_Threshold_Under_limit_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+static bool sio_Point_Scaling_Intercept_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
 
-    int value = (int)0 ;
+    int32_t value = (int32_t)0 ;
     int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
         snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
         retvalue = true ;
     }
     *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Range_Limitation_Over_count_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+static bool sio_Point_Scaling_Mask_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
 
-    int value = (int)0 ;
+    int32_t value = (int32_t)0 ;
     int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
         snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
         retvalue = true ;
     }
     *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Range_Limitation_Under_count_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+static bool sio_Point_Scaling_Deadband_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
 
-    int value = (int)0 ;
+    int32_t value = (int32_t)0 ;
     int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
         snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
         retvalue = true ;
     }
     *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Signal_Converter_Converter_available_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+static bool sio_Point_Threshold_Limit_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
 
-    bool value = (bool)0 ;
+    int32_t value = (int32_t)0 ;
     int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
         snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""u", value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
         retvalue = true ;
     }
     *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Conversion_Group_Waiting_for_converter_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+static bool sio_Point_Threshold_Direction_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
 
-    bool value = (bool)0 ;
+    uint8_t value = (uint8_t)0 ;
     int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
         snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""u", value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu8, value) ;
         retvalue = true ;
     }
     *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Conversion_Group_Period_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+static bool sio_Point_Threshold_Over_limit_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
 
-    uint32_t value = (uint32_t)0 ;
+    int value = (int)0 ;
     int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
         snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
         retvalue = true ;
     }
     *result = cvt_buffer ;
     return retvalue ;
 }
 
-
-static bool sio_Packed_Point_Length_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+static bool sio_Point_Threshold_Under_limit_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
-    *result = cvt_buffer ;
-    uint8_t value ;
-    if (sscanf(attr_value, "%"SCNi8, &value) != 1) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
-        return false ;
-    }
-    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+
+    int value = (int)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu8, value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
         retvalue = true ;
     }
+    *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Packed_Point_Offset_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+static bool sio_Signal_Converter_Converter_available_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
-    *result = cvt_buffer ;
-    uint8_t value ;
-    if (sscanf(attr_value, "%"SCNi8, &value) != 1) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
-        return false ;
-    }
-    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+
+    bool value = (bool)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu8, value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""u", value) ;
         retvalue = true ;
     }
+    *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Signalling_Point_Value_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+static bool sio_Signal_Converter_Conversion_count_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
-    *result = cvt_buffer ;
-    int32_t value ;
-    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
-        return false ;
-    }
-    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+
+    int value = (int)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
         retvalue = true ;
     }
+    *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Signalling_Point_Trigger_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+static bool sio_Signal_Converter_Busy_time_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
-    *result = cvt_buffer ;
-    uint8_t value ;
-    if (sscanf(attr_value, "%"SCNi8, &value) != 1) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
-        return false ;
-    }
-    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+
+    uint32_t value = (uint32_t)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu8, value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
         retvalue = true ;
     }
+    *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Signalling_Point_Active_high_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+static bool sio_Signal_Converter_Idle_time_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
-    *result = cvt_buffer ;
-    uint8_t value ;
-    if (sscanf(attr_value, "%"SCNi8, &value) != 1) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
-        return false ;
-    }
-    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+
+    uint32_t value = (uint32_t)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu8, value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
         retvalue = true ;
     }
+    *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Signalling_Point_Debounce_time_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+static bool sio_Signal_Converter_Changed_at_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
-    *result = cvt_buffer ;
-    uint32_t value ;
-    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
-        return false ;
-    }
-    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+
+    uint32_t value = (uint32_t)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
         snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
         retvalue = true ;
     }
+    *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Control_Point_Memory_model_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+static bool sio_Conversion_Group_Waiting_for_converter_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
-    *result = cvt_buffer ;
-    uint8_t value ;
-    if (sscanf(attr_value, "%"SCNi8, &value) != 1) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
-        return false ;
-    }
-    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+
+    bool value = (bool)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu8, value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""u", value) ;
         retvalue = true ;
     }
+    *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Control_Point_Access_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+static bool sio_Conversion_Group_Period_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
-    *result = cvt_buffer ;
-    uint8_t value ;
-    if (sscanf(attr_value, "%"SCNi8, &value) != 1) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
-        return false ;
-    }
-    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+
+    uint32_t value = (uint32_t)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu8, value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
         retvalue = true ;
     }
+    *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Continuous_Input_Point_Value_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+static bool sio_Conversion_Group_Scheduled_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
 {
     bool retvalue ;
-    *result = cvt_buffer ;
-    int32_t value ;
-    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
-        return false ;
-    }
-    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+
+    bool value = (bool)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""u", value) ;
         retvalue = true ;
     }
+    *result = cvt_buffer ;
     return retvalue ;
 }
 
-static bool sio_Point_Scaling_Multiplier_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+static bool sio_Conversion_Group_Sample_pending_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+{
+    bool retvalue ;
+
+    bool value = (bool)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""u", value) ;
+        retvalue = true ;
+    }
+    *result = cvt_buffer ;
+    return retvalue ;
+}
+
+static bool sio_Conversion_Group_Next_sample_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+{
+    bool retvalue ;
+
+    uint32_t value = (uint32_t)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
+    }
+    *result = cvt_buffer ;
+    return retvalue ;
+}
+
+static bool sio_Conversion_Group_Sample_count_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+{
+    bool retvalue ;
+
+    int value = (int)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
+        retvalue = true ;
+    }
+    *result = cvt_buffer ;
+    return retvalue ;
+}
+
+static bool sio_Conversion_Group_Overrun_count_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+{
+    bool retvalue ;
+
+    int value = (int)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
+        retvalue = true ;
+    }
+    *result = cvt_buffer ;
+    return retvalue ;
+}
+
+static bool sio_Conversion_Group_Max_jitter_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+{
+    bool retvalue ;
+
+    uint32_t value = (uint32_t)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
+    }
+    *result = cvt_buffer ;
+    return retvalue ;
+}
+
+static bool sio_Conversion_Group_Ready_at_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+{
+    bool retvalue ;
+
+    uint32_t value = (uint32_t)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
+    }
+    *result = cvt_buffer ;
+    return retvalue ;
+}
+
+static bool sio_Conversion_Group_Wait_time_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+{
+    bool retvalue ;
+
+    uint32_t value = (uint32_t)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
+    }
+    *result = cvt_buffer ;
+    return retvalue ;
+}
+
+static bool sio_Conversion_Group_Max_wait_read(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const **result)
+{
+    bool retvalue ;
+
+    uint32_t value = (uint32_t)0 ;
+    int err = pycca_read_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, read_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
+    }
+    *result = cvt_buffer ;
+    return retvalue ;
+}
+
+
+static bool sio_Packed_Point_Length_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint8_t value ;
+    if (sscanf(attr_value, "%"SCNi8, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu8, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Packed_Point_Offset_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint8_t value ;
+    if (sscanf(attr_value, "%"SCNi8, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu8, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Signalling_Point_Value_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    int32_t value ;
+    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Signalling_Point_Trigger_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint8_t value ;
+    if (sscanf(attr_value, "%"SCNi8, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu8, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Signalling_Point_Active_high_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint8_t value ;
+    if (sscanf(attr_value, "%"SCNi8, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu8, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Signalling_Point_Debounce_time_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint32_t value ;
+    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Control_Point_Memory_model_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint8_t value ;
+    if (sscanf(attr_value, "%"SCNi8, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu8, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Control_Point_Access_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint8_t value ;
+    if (sscanf(attr_value, "%"SCNi8, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu8, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Continuous_Input_Point_Value_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    int32_t value ;
+    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Continuous_Input_Point_Notify_interval_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint32_t value ;
+    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Continuous_Input_Point_Notified_value_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    int32_t value ;
+    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Continuous_Input_Point_Notified_at_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint32_t value ;
+    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Continuous_Input_Point_Forwarded_count_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    int value ;
+    if (sscanf(attr_value, "%""i", &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Continuous_Input_Point_Suppressed_count_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    int value ;
+    if (sscanf(attr_value, "%""i", &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Point_Scaling_Multiplier_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
 {
     bool retvalue ;
     *result = cvt_buffer ;
@@ -1231,6 +1779,26 @@ static bool sio_Point_Scaling_Mask_update(struct pycca_domain_portal const *port
     return retvalue ;
 }
 
+static bool sio_Point_Scaling_Deadband_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    int32_t value ;
+    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRId32, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
 static bool sio_Point_Threshold_Limit_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
 {
     bool retvalue ;
@@ -1311,27 +1879,29 @@ static bool sio_Point_Threshold_Under_limit_update(struct pycca_domain_portal co
     return retvalue ;
 }
 
-static bool sio_Range_Limitation_Over_count_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+static bool sio_Signal_Converter_Converter_available_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
 {
     bool retvalue ;
     *result = cvt_buffer ;
-    int value ;
-    if (sscanf(attr_value, "%""i", &value) != 1) {
+    bool value ;
+    unsigned tmp_value ;
+    if (sscanf(attr_value, "%""u", &tmp_value) != 1) {
         snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
         return false ;
     }
+    value = tmp_value ;
     int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
     if (err < 0) {
         snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
         retvalue = false ;
     } else {
-        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""u", value) ;
         retvalue = true ;
     }
     return retvalue ;
 }
 
-static bool sio_Range_Limitation_Under_count_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+static bool sio_Signal_Converter_Conversion_count_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
 {
     bool retvalue ;
     *result = cvt_buffer ;
@@ -1351,7 +1921,67 @@ static bool sio_Range_Limitation_Under_count_update(struct pycca_domain_portal c
     return retvalue ;
 }
 
-static bool sio_Signal_Converter_Converter_available_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+static bool sio_Signal_Converter_Busy_time_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint32_t value ;
+    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Signal_Converter_Idle_time_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint32_t value ;
+    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Signal_Converter_Changed_at_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint32_t value ;
+    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Conversion_Group_Waiting_for_converter_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
 {
     bool retvalue ;
     *result = cvt_buffer ;
@@ -1373,7 +2003,27 @@ static bool sio_Signal_Converter_Converter_available_update(struct pycca_domain_
     return retvalue ;
 }
 
-static bool sio_Conversion_Group_Waiting_for_converter_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+static bool sio_Conversion_Group_Period_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint32_t value ;
+    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Conversion_Group_Scheduled_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
 {
     bool retvalue ;
     *result = cvt_buffer ;
@@ -1395,7 +2045,109 @@ static bool sio_Conversion_Group_Waiting_for_converter_update(struct pycca_domai
     return retvalue ;
 }
 
-static bool sio_Conversion_Group_Period_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+static bool sio_Conversion_Group_Sample_pending_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    bool value ;
+    unsigned tmp_value ;
+    if (sscanf(attr_value, "%""u", &tmp_value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    value = tmp_value ;
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""u", value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Conversion_Group_Next_sample_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint32_t value ;
+    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Conversion_Group_Sample_count_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    int value ;
+    if (sscanf(attr_value, "%""i", &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Conversion_Group_Overrun_count_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    int value ;
+    if (sscanf(attr_value, "%""i", &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%""d", value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Conversion_Group_Max_jitter_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint32_t value ;
+    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
+
+static bool sio_Conversion_Group_Ready_at_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
 {
     bool retvalue ;
     *result = cvt_buffer ;
@@ -1415,18 +2167,45 @@ static bool sio_Conversion_Group_Period_update(struct pycca_domain_portal const
     return retvalue ;
 }
 
+static bool sio_Conversion_Group_Wait_time_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
+{
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint32_t value ;
+    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
+    } else {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
+    }
+    return retvalue ;
+}
 
-static int sio_Range_Limitation_New_point_fmt(EventParamType *params, int argc, char const **argv)
+static bool sio_Conversion_Group_Max_wait_update(struct pycca_domain_portal const *portal, unsigned class_id, unsigned inst_id, unsigned attr_id, char const *attr_value, char const **result)
 {
-    struct New_point_params {
-        sio_Point_Value pointValue ;
-    } *pp = (struct New_point_params *)params ;
-    int pnum = 0 ;
-    if (sscanf(*argv++, "%"SCNi32, &pp->pointValue) != 1) {
-        return pnum ;
+    bool retvalue ;
+    *result = cvt_buffer ;
+    uint32_t value ;
+    if (sscanf(attr_value, "%"SCNi32, &value) != 1) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer), bad_attr_value_msg, attr_value) ;
+        return false ;
+    }
+    int err = pycca_update_attr(portal, class_id, inst_id, attr_id, &value, sizeof(value)) ;
+    if (err < 0) {
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, write_err_msg, err) ;
+        retvalue = false ;
     } else {
-        pnum++ ;
+        snprintf(cvt_buffer, sizeof(cvt_buffer) - 1, "%"PRIu32, value) ;
+        retvalue = true ;
     }
-    return -1 ;
+    return retvalue ;
 }
 
+
+
@@ -34,7 +34,15 @@
 #include <stdbool.h>
 #include <inttypes.h>
 #include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <assert.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "mechs.h"
 #include "pycca_portal.h"
 #include "sio.h"
 #ifdef TACK
@@ -87,6 +95,197 @@ vs_nextValue(
 
     return cval ;
 }
+#define SIO_TRACE_MAGIC     "SIOTRACE"
+
+typedef struct {
+    bool opened ;
+    bool loaded ;
+    bool loop ;
+    double scale ;
+    uint32_t channels ;
+    uint32_t rows ;
+    int32_t const *data ;
+    bool present[SIO_IO_POINT_INST_COUNT] ;
+    uint32_t cursor ;
+    MechTime start ;
+} SampleTrace ;
+
+static SampleTrace sampleTrace = {
+    .loop = true,
+    .scale = 1.0,
+} ;
+static inline int32_t const *
+trace_row(
+    uint32_t row)
+{
+    return sampleTrace.data + (size_t)row * (sampleTrace.channels + 1) ;
+}
+static bool
+trace_parseCsv(
+    char const *text,
+    size_t size)
+{
+    char const *end = text + size ;
+    char const *nl = memchr(text, '\n', size) ;
+    if (nl == NULL) {
+        return false ;
+    }
+    uint32_t channels = 0 ;
+    for (char const *c = text ; c < nl ; c++) {
+        channels += *c == ',' ;
+    }
+    if (channels == 0 || channels > SIO_IO_POINT_INST_COUNT) {
+        return false ;
+    }
+    /*
+     * Map columns to I/O Point identifiers from the header.
+     */
+    uint32_t columns[SIO_IO_POINT_INST_COUNT] ;
+    char const *c = memchr(text, ',', nl - text) ;
+    for (uint32_t col = 0 ; col < channels ; col++) {
+        columns[col] = strtoul(c + 1, NULL, 10) ;
+        if (columns[col] >= SIO_IO_POINT_INST_COUNT) {
+            return false ;
+        }
+        sampleTrace.present[columns[col]] = true ;
+        c = memchr(c + 1, ',', nl - c - 1) ;
+    }
+
+    uint32_t lines = 0 ;
+    for (c = nl + 1 ; c < end ; c++) {
+        lines += *c == '\n' ;
+    }
+    lines += end[-1] != '\n' ;
+
+    uint32_t width = SIO_IO_POINT_INST_COUNT + 1 ;
+    int32_t *data = calloc((size_t)lines * width, sizeof(*data)) ;
+    if (data == NULL) {
+        return false ;
+    }
+
+    uint32_t rows = 0 ;
+    for (c = nl + 1 ; c < end && rows < lines ; ) {
+        int32_t *row = data + (size_t)rows * width ;
+        char *next ;
+        row[0] = strtol(c, &next, 10) ;
+        bool complete = next != c ;
+        for (uint32_t col = 0 ; complete && col < channels ; col++) {
+            c = next ;
+            complete = *c == ',' ;
+            if (complete) {
+                row[columns[col] + 1] = strtol(c + 1, &next, 10) ;
+            }
+        }
+        if (!complete) {
+            break ;
+        }
+        rows++ ;
+        c = memchr(next, '\n', end - next) ;
+        c = c ? c + 1 : end ;
+    }
+
+    sampleTrace.channels = SIO_IO_POINT_INST_COUNT ;
+    sampleTrace.rows = rows ;
+    sampleTrace.data = data ;
+    return rows != 0 ;
+}
+static void
+trace_open(void)
+{
+    sampleTrace.opened = true ;
+
+    char const *name = getenv("SIO_TRACE") ;
+    if (name == NULL) {
+        return ;
+    }
+    char const *scale = getenv("SIO_TRACE_SCALE") ;
+    if (scale) {
+        sampleTrace.scale = strtod(scale, NULL) ;
+    }
+    char const *loop = getenv("SIO_TRACE_LOOP") ;
+    if (loop) {
+        sampleTrace.loop = strcmp(loop, "0") != 0 ;
+    }
+
+    int fd = open(name, O_RDONLY) ;
+    if (fd == -1) {
+        perror(name) ;
+        return ;
+    }
+    struct stat st ;
+    if (fstat(fd, &st) == -1 || st.st_size == 0) {
+        perror(name) ;
+        close(fd) ;
+        return ;
+    }
+    size_t size = st.st_size ;
+    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0) ;
+    close(fd) ;
+    if (map == MAP_FAILED) {
+        perror(name) ;
+        return ;
+    }
+
+    size_t header = sizeof(SIO_TRACE_MAGIC) - 1 + 2 * sizeof(uint32_t) ;
+    if (size >= header &&
+            memcmp(map, SIO_TRACE_MAGIC, sizeof(SIO_TRACE_MAGIC) - 1) == 0) {
+        uint32_t const *counts = (uint32_t const *)((char const *)map +
+                sizeof(SIO_TRACE_MAGIC) - 1) ;
+        sampleTrace.channels = counts[0] ;
+        sampleTrace.rows = counts[1] ;
+        sampleTrace.data = (int32_t const *)(counts + 2) ;
+        size_t need = header + (size_t)sampleTrace.rows *
+                (sampleTrace.channels + 1) * sizeof(int32_t) ;
+        sampleTrace.loaded = sampleTrace.rows != 0 && need <= size ;
+        for (uint32_t p = 0 ; p < sampleTrace.channels &&
+                p < SIO_IO_POINT_INST_COUNT ; p++) {
+            sampleTrace.present[p] = true ;
+        }
+    } else {
+        sampleTrace.loaded = trace_parseCsv(map, size) ;
+        munmap(map, size) ;
+    }
+
+    if (sampleTrace.loaded) {
+        sampleTrace.start = mechNow() ;
+    } else {
+        fprintf(stderr, "%s: not a valid sample trace\n", name) ;
+    }
+}
+static bool
+trace_value(
+    sio_Point_ID point,
+    sio_Point_Value *value)
+{
+    if (!sampleTrace.opened) {
+        trace_open() ;
+    }
+    if (!sampleTrace.loaded || !sampleTrace.present[point]) {
+        return false ;
+    }
+
+    double elapsed = (mechNow() - sampleTrace.start) / 1000.0 ;
+    uint64_t t = (uint64_t)(elapsed * sampleTrace.scale) ;
+
+    uint32_t first = trace_row(0)[0] ;
+    uint32_t last = trace_row(sampleTrace.rows - 1)[0] ;
+    t += first ;
+    if (t >= last) {
+        t = sampleTrace.loop && last > first ?
+                first + (t - first) % (last - first) : last ;
+    }
+
+    if (t < (uint32_t)trace_row(sampleTrace.cursor)[0]) {
+        sampleTrace.cursor = 0 ;
+    }
+    while (sampleTrace.cursor + 1 < sampleTrace.rows &&
+            (uint32_t)trace_row(sampleTrace.cursor + 1)[0] <= t) {
+        sampleTrace.cursor++ ;
+    }
+
+    *value = trace_row(sampleTrace.cursor)[point + 1] ;
+    return true ;
+}
 static sio_Point_Value inj1PresValues[] = {20, 21, 22, 26, 27, 16, 15, 14} ;
 static sio_Point_Value inj2PresValues[] = {20, 21, 22, 26, 27, 23, 19, 18} ;
 static sio_Point_Value inj3PresValues[] = {20, 21, 22, 26, 27, 23, 19, 18} ;
@@ -126,6 +325,10 @@ eop_sio_DEVICE_Read_converted_value(
     assert(converter <= SIO_SIGNAL_CONVERTER_INST_COUNT) ;
     assert(point < SIO_IO_POINT_INST_COUNT) ;
 
+    sio_Point_Value value ;
+    if (trace_value(point, &value)) {
+        return value ;
+    }
     /*
      * Offset the point id to reorg to the beginning of Continuous Input
      * Point numbering.
@@ -178,5 +381,9 @@ eop_sio_DEVICE_Read_reg(
 
     assert(pid < SIO_IO_POINT_INST_COUNT) ;
 
+    sio_Point_Value value ;
+    if (trace_value(pid, &value)) {
+        return value ;
+    }
     return vs_nextValue(&registerValues[pid]) ;
 }
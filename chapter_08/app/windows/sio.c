@@ -222,6 +222,76 @@ typedef enum {Inactive, Active, BothActive} Edge_Type ;
 typedef uint8_t Bit_Count ;
 typedef uint8_t Bit_Offset ;
 typedef enum {Rising, Falling} Excursion_Direction ;
+typedef struct {
+    struct Conversion_Group *groups[SIO_CONVERSION_GROUP_INST_COUNT] ;
+    unsigned head ;
+    unsigned count ;
+} Ready_Queue ;
+
+static Ready_Queue readyQueues[SIO_SIGNAL_CONVERTER_INST_COUNT] ;
+static bool queued[SIO_CONVERSION_GROUP_INST_COUNT] ;
+#define SAMPLING_EARLY_TOLERANCE    1
+#define DEBOUNCE_SCAN_PERIOD    50
+#define GeneratePeriodicToSelf(e, i, p)\
+    mechEventGeneratePeriodicToSelf(EventNumber(THISCLASS__, e),\
+            (MechInstance)(i), p)
+
+typedef struct {
+    Msec clock ;
+    unsigned pendingCount ;
+    bool pending[SIO_IO_POINT_INST_COUNT] ;
+    Msec edge[SIO_IO_POINT_INST_COUNT] ;
+    struct Signalling_Point *point[SIO_IO_POINT_INST_COUNT] ;
+} Debounce_Schedule ;
+
+static Debounce_Schedule debounce ;
+typedef enum {
+    Leaf_Unresolved,
+    Leaf_Packed_Point,
+    Leaf_Control_Point,
+    Leaf_Signalling_Point,
+    Leaf_Continuous_Input_Point,
+    Leaf_Continuous_Output_Point,
+} Point_Leaf ;
+
+typedef struct {
+    Point_Leaf leaf ;
+    void *ref ;
+} Point_Accessor ;
+
+static Point_Accessor pointAccessors[SIO_IO_POINT_INST_COUNT] ;
+typedef struct {
+    bool dirty[SIO_IO_POINT_INST_COUNT] ;
+    sio_Point_Value image[SIO_IO_POINT_INST_COUNT] ;
+    struct Control_Point *point[SIO_IO_POINT_INST_COUNT] ;
+} Shadow_Registers ;
+
+static Shadow_Registers shadow ;
+#if SIO_RANGE_LIMITATION_INST_COUNT <= UINT8_MAX
+typedef uint8_t Threshold_Slot ;
+#else
+typedef uint16_t Threshold_Slot ;
+#endif
+typedef struct {
+    bool loaded ;
+    struct {
+        Threshold_Slot first ;
+        Threshold_Slot count ;
+    } points[SIO_IO_POINT_INST_COUNT] ;
+    struct Point_Threshold const *threshold[SIO_RANGE_LIMITATION_INST_COUNT] ;
+    bool outOfRange[SIO_RANGE_LIMITATION_INST_COUNT] ;
+    Count count[SIO_RANGE_LIMITATION_INST_COUNT] ;      // <1>
+    Threshold_Slot limitation[SIO_RANGE_LIMITATION_INST_COUNT] ;    // <2>
+} Threshold_Vector ;
+
+static Threshold_Vector thresholds ;
+typedef struct {
+    sio_Point_Value values[SIO_CONTINUOUS_INPUT_POINT_INST_COUNT] ;
+    sio_Point_Value multiplier[SIO_CONTINUOUS_INPUT_POINT_INST_COUNT] ;
+    sio_Point_Value divisor[SIO_CONTINUOUS_INPUT_POINT_INST_COUNT] ;
+    sio_Point_Value intercept[SIO_CONTINUOUS_INPUT_POINT_INST_COUNT] ;
+    Point_Value_Mask mask[SIO_CONTINUOUS_INPUT_POINT_INST_COUNT] ;
+} Scaling_Vector ;
 
 
 #ifdef INSTRUMENT
@@ -266,9 +336,7 @@ extern void eop_sio_DEVICE_Disable_signal(sio_Point_ID pid) ;
  */
 #define Range_Limitation_IN_RANGE_STATE 0
 #define Range_Limitation_INITIAL_STATE 0
-#define Range_Limitation_CHECKING_OUT_OF_RANGE_STATE 1
-#define Range_Limitation_OUT_OF_RANGE_STATE 2
-#define Range_Limitation_CHECKING_IN_RANGE_STATE 3
+#define Range_Limitation_OUT_OF_RANGE_STATE 1
 /*
  * State Numbers for Class, "Signal_Converter"
  */
@@ -289,6 +357,21 @@ extern void eop_sio_DEVICE_Disable_signal(sio_Point_ID pid) ;
 #define R6_Assigner_INITIAL_STATE 0
 #define R6_Assigner_WAITING_FOR_CONVERTER_STATE 1
 #define R6_Assigner_Assigning_Converter_STATE 2
+/*
+ * State Numbers for Class, "Debounce_Scanner"
+ */
+#define Debounce_Scanner_IDLE_STATE 0
+#define Debounce_Scanner_INITIAL_STATE 0
+#define Debounce_Scanner_STARTING_STATE 1
+#define Debounce_Scanner_WAITING_STATE 2
+#define Debounce_Scanner_SCANNING_STATE 3
+/*
+ * State Numbers for Class, "Sampling_Scheduler"
+ */
+#define Sampling_Scheduler_IDLE_STATE 0
+#define Sampling_Scheduler_INITIAL_STATE 0
+#define Sampling_Scheduler_WAITING_STATE 1
+#define Sampling_Scheduler_SAMPLING_STATE 2
 /*
  * Pseudo initial states for inactive classes.
  */
@@ -316,8 +399,7 @@ extern void eop_sio_DEVICE_Disable_signal(sio_Point_ID pid) ;
  * Event Numbers for Class, "Range_Limitation"
  */
 #define Range_Limitation_In_range_EVENT 0
-#define Range_Limitation_New_point_EVENT 1
-#define Range_Limitation_Out_of_range_EVENT 2
+#define Range_Limitation_Out_of_range_EVENT 1
 /*
  * Event Numbers for Class, "Signal_Converter"
  */
@@ -335,6 +417,20 @@ extern void eop_sio_DEVICE_Disable_signal(sio_Point_ID pid) ;
 #define R6_Assigner_Converter_assigned_EVENT 0
 #define R6_Assigner_Converter_ready_EVENT 1
 #define R6_Assigner_Group_ready_EVENT 2
+/*
+ * Event Numbers for Class, "Debounce_Scanner"
+ */
+#define Debounce_Scanner_Continue_EVENT 0
+#define Debounce_Scanner_Scan_EVENT 1
+#define Debounce_Scanner_Start_EVENT 2
+#define Debounce_Scanner_Stop_EVENT 3
+/*
+ * Event Numbers for Class, "Sampling_Scheduler"
+ */
+#define Sampling_Scheduler_Continue_EVENT 0
+#define Sampling_Scheduler_Start_EVENT 1
+#define Sampling_Scheduler_Stop_EVENT 2
+#define Sampling_Scheduler_Tick_EVENT 3
 
 /*
  * Subtype Numbering
@@ -409,6 +505,8 @@ extern void eop_sio_DEVICE_Disable_signal(sio_Point_ID pid) ;
 #define Conversion_Group_inj2_cg_INSTANCE 1
 #define Conversion_Group_inj3_cg_INSTANCE 2
 #define R6_Assigner_r6asgn1_INSTANCE 0
+#define Debounce_Scanner_dbscan1_INSTANCE 0
+#define Sampling_Scheduler_smpsched1_INSTANCE 0
 
 /*
  * Forward class structure declarations
@@ -427,6 +525,8 @@ struct Range_Limitation ;
 struct Signal_Converter ;
 struct Conversion_Group ;
 struct R6_Assigner ;
+struct Debounce_Scanner ;
+struct Sampling_Scheduler ;
 
 /*
  * Class structure definitions
@@ -435,6 +535,12 @@ struct Continuous_Output_Point {
 } ;
 struct Continuous_Input_Point {
     sio_Point_Value Value ;
+    Msec Notify_interval ;
+    sio_Point_Value Notified_value ;
+    Msec Notified_at ;
+    bool Notified ;
+    Count Forwarded_count ;
+    Count Suppressed_count ;
     struct Range_Limitation *const*const R7 ;
     unsigned R7__count ;
     struct Conversion_Group *R4 ;
@@ -483,6 +589,7 @@ struct Point_Scaling {
     sio_Point_Value Divisor ;
     sio_Point_Value Intercept ;
     Point_Value_Mask Mask ;
+    sio_Point_Value Deadband ;
 } ;
 struct Point_Threshold {
     sio_Point_Value Limit ;
@@ -492,14 +599,16 @@ struct Point_Threshold {
 } ;
 struct Range_Limitation {
     struct mechinstance common_ ; // must be first !
-    Count Over_count ;
-    Count Under_count ;
     struct Point_Threshold *R7_PT ;
     struct Continuous_Input_Point *R7_CIP ;
 } ;
 struct Signal_Converter {
     struct mechinstance common_ ; // must be first !
     bool Converter_available ;
+    Count Conversion_count ;
+    Msec Busy_time ;
+    Msec Idle_time ;
+    Msec Changed_at ;
     struct Conversion_Group *const*const R5 ;
     unsigned R5__count ;
     struct Conversion_Group *R6 ;
@@ -509,6 +618,15 @@ struct Conversion_Group {
     struct mechinstance common_ ; // must be first !
     bool Waiting_for_converter ;
     Msec Period ;
+    bool Scheduled ;
+    bool Sample_pending ;
+    Msec Next_sample ;
+    Count Sample_count ;
+    Count Overrun_count ;
+    Msec Max_jitter ;
+    Msec Ready_at ;
+    Msec Wait_time ;
+    Msec Max_wait ;
     struct Continuous_Input_Point *const*const R4 ;
     unsigned R4__count ;
     struct Signal_Converter *R5 ;
@@ -517,33 +635,44 @@ struct R6_Assigner {
     struct mechinstance common_ ; // must be first !
     struct Signal_Converter *idclass ;
 } ;
+struct Debounce_Scanner {
+    struct mechinstance common_ ; // must be first !
+} ;
+struct Sampling_Scheduler {
+    struct mechinstance common_ ; // must be first !
+} ;
 
 /*
  * Event Parameter Structure Definitions
  */
-struct Range_Limitation_New_point_rcvd_evt {
-    sio_Point_Value pointValue ;
-} ;
 
 
 /*
  * Forward Operation Function Declarations
  */
+static void IO_Point_resolveAccessor(struct IO_Point *self) ;
+static Point_Accessor * IO_Point_accessor(struct IO_Point *self) ;
 static sio_Point_Value IO_Point_readPoint(struct IO_Point *self) ;
 static void IO_Point_writePoint(struct IO_Point *self, sio_Point_Value value) ;
-static sio_Point_Value Discrete_Point_readPoint(struct Discrete_Point *self) ;
-static void Discrete_Point_writePoint(struct Discrete_Point *self, sio_Point_Value value) ;
 static void Signalling_Point_evalSignal(struct Signalling_Point *self) ;
+static void Signalling_Point_startDebounce(struct Signalling_Point *self) ;
+static void Signalling_Point_cancelDebounce(struct Signalling_Point *self) ;
 static sio_Point_Value Signalling_Point_readPoint(struct Signalling_Point *self) ;
-static sio_Point_Value Continuous_Point_readPoint(struct Continuous_Point *self) ;
 static void Continuous_Point_writePoint(struct Continuous_Point *self, sio_Point_Value value) ;
 static sio_Point_Value Packed_Point_readPoint(struct Packed_Point *self) ;
 static void Packed_Point_writePoint(struct Packed_Point *self, sio_Point_Value value) ;
 static sio_Point_Value Control_Point_readPoint(struct Control_Point *self) ;
 static void Control_Point_writePoint(struct Control_Point *self, sio_Point_Value value) ;
+static void Control_Point_writeField(struct Control_Point *self, sio_Point_Value mask, sio_Point_Value value) ;
+static void Control_Point_flushShadows(void) ;
 static void Continuous_Input_Point_updateValue(struct Continuous_Input_Point *self, sio_Point_Value value) ;
-static sio_Point_Value Point_Scaling_scaleValueIn(struct Point_Scaling *self, sio_Point_Value value) ;
+static void Continuous_Input_Point_loadThresholds(void) ;
+static void Continuous_Input_Point_checkThresholds(struct Continuous_Input_Point *self) ;
+static void Point_Scaling_scaleValuesIn(Scaling_Vector *sv, unsigned count) ;
 static sio_Point_Value Point_Scaling_scaleValueOut(struct Point_Scaling *self, sio_Point_Value value) ;
+static void Conversion_Group_schedule(struct Conversion_Group *self) ;
+static void R6_Assigner_enqueue(struct R6_Assigner *self, struct Conversion_Group *cg) ;
+static struct Conversion_Group * R6_Assigner_nextReady(struct R6_Assigner *self, bool take) ;
 
 /*
  * Forward Declarations of Class Constructors
@@ -559,13 +688,18 @@ static sio_Point_Value Point_Scaling_scaleValueOut(struct Point_Scaling *self, s
 static void Conversion_Group_CONVERSION_COMPLETED(void *const s_, void *const p_) ;
 static void Conversion_Group_FINISHED(void *const s_, void *const p_) ;
 static void Conversion_Group_WAITING_FOR_CONVERSION(void *const s_, void *const p_) ;
+static void Debounce_Scanner_IDLE(void *const s_, void *const p_) ;
+static void Debounce_Scanner_SCANNING(void *const s_, void *const p_) ;
+static void Debounce_Scanner_STARTING(void *const s_, void *const p_) ;
+static void Debounce_Scanner_WAITING(void *const s_, void *const p_) ;
 static void R6_Assigner_Assigning_Converter(void *const s_, void *const p_) ;
 static void R6_Assigner_WAITING_FOR_CONVERTER(void *const s_, void *const p_) ;
 static void R6_Assigner_WAITING_FOR_GROUP(void *const s_, void *const p_) ;
-static void Range_Limitation_CHECKING_IN_RANGE(void *const s_, void *const p_) ;
-static void Range_Limitation_CHECKING_OUT_OF_RANGE(void *const s_, void *const p_) ;
 static void Range_Limitation_IN_RANGE(void *const s_, void *const p_) ;
 static void Range_Limitation_OUT_OF_RANGE(void *const s_, void *const p_) ;
+static void Sampling_Scheduler_IDLE(void *const s_, void *const p_) ;
+static void Sampling_Scheduler_SAMPLING(void *const s_, void *const p_) ;
+static void Sampling_Scheduler_WAITING(void *const s_, void *const p_) ;
 static void Signal_Converter_CONVERSION_COMPLETE(void *const s_, void *const p_) ;
 static void Signal_Converter_CONVERTING(void *const s_, void *const p_) ;
 static void Signalling_Point_CONFIRMING(void *const s_, void *const p_) ;
@@ -594,6 +728,8 @@ static struct Range_Limitation Range_Limitation_storage[] ;
 static struct Signal_Converter Signal_Converter_storage[] ;
 static struct Conversion_Group Conversion_Group_storage[] ;
 static struct R6_Assigner R6_Assigner_storage[] ;
+static struct Debounce_Scanner Debounce_Scanner_storage[] ;
+static struct Sampling_Scheduler Sampling_Scheduler_storage[] ;
 
 
 /*
@@ -639,27 +775,17 @@ static struct objectdispatchblock const Signalling_Point_odb = {
  */
 static PtrActionFunction const Range_Limitation_acttbl[] = {
     Range_Limitation_IN_RANGE,
-    Range_Limitation_CHECKING_OUT_OF_RANGE,
     Range_Limitation_OUT_OF_RANGE,
-    Range_Limitation_CHECKING_IN_RANGE,
 } ;
 static StateCode const Range_Limitation_transtbl[] = {
     MECH_STATECODE_CH, // IN_RANGE - In_range -> CH
-    1, // IN_RANGE - New_point -> CHECKING_OUT_OF_RANGE
-    MECH_STATECODE_CH, // IN_RANGE - Out_of_range -> CH
-    MECH_STATECODE_CH, // CHECKING_OUT_OF_RANGE - In_range -> CH
-    1, // CHECKING_OUT_OF_RANGE - New_point -> CHECKING_OUT_OF_RANGE
-    2, // CHECKING_OUT_OF_RANGE - Out_of_range -> OUT_OF_RANGE
-    MECH_STATECODE_CH, // OUT_OF_RANGE - In_range -> CH
-    3, // OUT_OF_RANGE - New_point -> CHECKING_IN_RANGE
+    1, // IN_RANGE - Out_of_range -> OUT_OF_RANGE
+    0, // OUT_OF_RANGE - In_range -> IN_RANGE
     MECH_STATECODE_CH, // OUT_OF_RANGE - Out_of_range -> CH
-    0, // CHECKING_IN_RANGE - In_range -> IN_RANGE
-    3, // CHECKING_IN_RANGE - New_point -> CHECKING_IN_RANGE
-    MECH_STATECODE_CH, // CHECKING_IN_RANGE - Out_of_range -> CH
 } ;
 static struct objectdispatchblock const Range_Limitation_odb = {
-    .stateCount = 4,
-    .eventCount = 3,
+    .stateCount = 2,
+    .eventCount = 2,
     .transitionTable = Range_Limitation_transtbl,
     .actionTable = Range_Limitation_acttbl,
     .finalStates = NULL
@@ -736,6 +862,69 @@ static struct objectdispatchblock const R6_Assigner_odb = {
     .actionTable = R6_Assigner_acttbl,
     .finalStates = NULL
 } ;
+/*
+ * AODB for Class, "Debounce_Scanner"
+ */
+static PtrActionFunction const Debounce_Scanner_acttbl[] = {
+    Debounce_Scanner_IDLE,
+    Debounce_Scanner_STARTING,
+    Debounce_Scanner_WAITING,
+    Debounce_Scanner_SCANNING,
+} ;
+static StateCode const Debounce_Scanner_transtbl[] = {
+    MECH_STATECODE_IG, // IDLE - Continue -> IG
+    MECH_STATECODE_IG, // IDLE - Scan -> IG
+    1, // IDLE - Start -> STARTING
+    MECH_STATECODE_IG, // IDLE - Stop -> IG
+    MECH_STATECODE_IG, // STARTING - Continue -> IG
+    3, // STARTING - Scan -> SCANNING
+    MECH_STATECODE_IG, // STARTING - Start -> IG
+    MECH_STATECODE_IG, // STARTING - Stop -> IG
+    MECH_STATECODE_IG, // WAITING - Continue -> IG
+    3, // WAITING - Scan -> SCANNING
+    MECH_STATECODE_IG, // WAITING - Start -> IG
+    MECH_STATECODE_IG, // WAITING - Stop -> IG
+    2, // SCANNING - Continue -> WAITING
+    MECH_STATECODE_IG, // SCANNING - Scan -> IG
+    MECH_STATECODE_IG, // SCANNING - Start -> IG
+    0, // SCANNING - Stop -> IDLE
+} ;
+static struct objectdispatchblock const Debounce_Scanner_odb = {
+    .stateCount = 4,
+    .eventCount = 4,
+    .transitionTable = Debounce_Scanner_transtbl,
+    .actionTable = Debounce_Scanner_acttbl,
+    .finalStates = NULL
+} ;
+/*
+ * AODB for Class, "Sampling_Scheduler"
+ */
+static PtrActionFunction const Sampling_Scheduler_acttbl[] = {
+    Sampling_Scheduler_IDLE,
+    Sampling_Scheduler_WAITING,
+    Sampling_Scheduler_SAMPLING,
+} ;
+static StateCode const Sampling_Scheduler_transtbl[] = {
+    MECH_STATECODE_IG, // IDLE - Continue -> IG
+    1, // IDLE - Start -> WAITING
+    MECH_STATECODE_IG, // IDLE - Stop -> IG
+    MECH_STATECODE_IG, // IDLE - Tick -> IG
+    MECH_STATECODE_IG, // WAITING - Continue -> IG
+    1, // WAITING - Start -> WAITING
+    0, // WAITING - Stop -> IDLE
+    2, // WAITING - Tick -> SAMPLING
+    1, // SAMPLING - Continue -> WAITING
+    MECH_STATECODE_IG, // SAMPLING - Start -> IG
+    MECH_STATECODE_IG, // SAMPLING - Stop -> IG
+    MECH_STATECODE_IG, // SAMPLING - Tick -> IG
+} ;
+static struct objectdispatchblock const Sampling_Scheduler_odb = {
+    .stateCount = 3,
+    .eventCount = 4,
+    .transitionTable = Sampling_Scheduler_transtbl,
+    .actionTable = Sampling_Scheduler_acttbl,
+    .finalStates = NULL
+} ;
 
 
 /*
@@ -778,6 +967,22 @@ static struct mechclass const R6_Assigner_class = {
     .odb = &R6_Assigner_odb,
     .pdb = NULL
 } ;
+/*
+ * Class Structure for, "Debounce_Scanner"
+ */
+static struct mechclass const Debounce_Scanner_class = {
+    .iab = NULL,
+    .odb = &Debounce_Scanner_odb,
+    .pdb = NULL
+} ;
+/*
+ * Class Structure for, "Sampling_Scheduler"
+ */
+static struct mechclass const Sampling_Scheduler_class = {
+    .iab = NULL,
+    .odb = &Sampling_Scheduler_odb,
+    .pdb = NULL
+} ;
 
 
 /*
@@ -807,14 +1012,21 @@ static struct pycca_attr_portal const Control_Point_attr_portal[2] = {
     {.offset = offsetof(struct Control_Point, Memory_model), .size = sizeof(IO_Point_storage->R1.R1_Discrete_Point.R8.R8_Control_Point.Memory_model)},
     {.offset = offsetof(struct Control_Point, Access), .size = sizeof(IO_Point_storage->R1.R1_Discrete_Point.R8.R8_Control_Point.Access)},
 } ;
-static struct pycca_attr_portal const Continuous_Input_Point_attr_portal[1] = {
+static struct pycca_attr_portal const Continuous_Input_Point_attr_portal[7] = {
     {.offset = offsetof(struct Continuous_Input_Point, Value), .size = sizeof(IO_Point_storage->R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point.Value)},
+    {.offset = offsetof(struct Continuous_Input_Point, Notify_interval), .size = sizeof(IO_Point_storage->R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point.Notify_interval)},
+    {.offset = offsetof(struct Continuous_Input_Point, Notified_value), .size = sizeof(IO_Point_storage->R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point.Notified_value)},
+    {.offset = offsetof(struct Continuous_Input_Point, Notified_at), .size = sizeof(IO_Point_storage->R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point.Notified_at)},
+    {.offset = offsetof(struct Continuous_Input_Point, Notified), .size = sizeof(IO_Point_storage->R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point.Notified)},
+    {.offset = offsetof(struct Continuous_Input_Point, Forwarded_count), .size = sizeof(IO_Point_storage->R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point.Forwarded_count)},
+    {.offset = offsetof(struct Continuous_Input_Point, Suppressed_count), .size = sizeof(IO_Point_storage->R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point.Suppressed_count)},
 } ;
-static struct pycca_attr_portal const Point_Scaling_attr_portal[4] = {
+static struct pycca_attr_portal const Point_Scaling_attr_portal[5] = {
     {.offset = offsetof(struct Point_Scaling, Multiplier), .size = sizeof(Point_Scaling_storage->Multiplier)},
     {.offset = offsetof(struct Point_Scaling, Divisor), .size = sizeof(Point_Scaling_storage->Divisor)},
     {.offset = offsetof(struct Point_Scaling, Intercept), .size = sizeof(Point_Scaling_storage->Intercept)},
     {.offset = offsetof(struct Point_Scaling, Mask), .size = sizeof(Point_Scaling_storage->Mask)},
+    {.offset = offsetof(struct Point_Scaling, Deadband), .size = sizeof(Point_Scaling_storage->Deadband)},
 } ;
 static struct pycca_attr_portal const Point_Threshold_attr_portal[4] = {
     {.offset = offsetof(struct Point_Threshold, Limit), .size = sizeof(Point_Threshold_storage->Limit)},
@@ -822,16 +1034,25 @@ static struct pycca_attr_portal const Point_Threshold_attr_portal[4] = {
     {.offset = offsetof(struct Point_Threshold, Over_limit), .size = sizeof(Point_Threshold_storage->Over_limit)},
     {.offset = offsetof(struct Point_Threshold, Under_limit), .size = sizeof(Point_Threshold_storage->Under_limit)},
 } ;
-static struct pycca_attr_portal const Range_Limitation_attr_portal[2] = {
-    {.offset = offsetof(struct Range_Limitation, Over_count), .size = sizeof(Range_Limitation_storage->Over_count)},
-    {.offset = offsetof(struct Range_Limitation, Under_count), .size = sizeof(Range_Limitation_storage->Under_count)},
-} ;
-static struct pycca_attr_portal const Signal_Converter_attr_portal[1] = {
+static struct pycca_attr_portal const Signal_Converter_attr_portal[5] = {
     {.offset = offsetof(struct Signal_Converter, Converter_available), .size = sizeof(Signal_Converter_storage->Converter_available)},
+    {.offset = offsetof(struct Signal_Converter, Conversion_count), .size = sizeof(Signal_Converter_storage->Conversion_count)},
+    {.offset = offsetof(struct Signal_Converter, Busy_time), .size = sizeof(Signal_Converter_storage->Busy_time)},
+    {.offset = offsetof(struct Signal_Converter, Idle_time), .size = sizeof(Signal_Converter_storage->Idle_time)},
+    {.offset = offsetof(struct Signal_Converter, Changed_at), .size = sizeof(Signal_Converter_storage->Changed_at)},
 } ;
-static struct pycca_attr_portal const Conversion_Group_attr_portal[2] = {
+static struct pycca_attr_portal const Conversion_Group_attr_portal[11] = {
     {.offset = offsetof(struct Conversion_Group, Waiting_for_converter), .size = sizeof(Conversion_Group_storage->Waiting_for_converter)},
     {.offset = offsetof(struct Conversion_Group, Period), .size = sizeof(Conversion_Group_storage->Period)},
+    {.offset = offsetof(struct Conversion_Group, Scheduled), .size = sizeof(Conversion_Group_storage->Scheduled)},
+    {.offset = offsetof(struct Conversion_Group, Sample_pending), .size = sizeof(Conversion_Group_storage->Sample_pending)},
+    {.offset = offsetof(struct Conversion_Group, Next_sample), .size = sizeof(Conversion_Group_storage->Next_sample)},
+    {.offset = offsetof(struct Conversion_Group, Sample_count), .size = sizeof(Conversion_Group_storage->Sample_count)},
+    {.offset = offsetof(struct Conversion_Group, Overrun_count), .size = sizeof(Conversion_Group_storage->Overrun_count)},
+    {.offset = offsetof(struct Conversion_Group, Max_jitter), .size = sizeof(Conversion_Group_storage->Max_jitter)},
+    {.offset = offsetof(struct Conversion_Group, Ready_at), .size = sizeof(Conversion_Group_storage->Ready_at)},
+    {.offset = offsetof(struct Conversion_Group, Wait_time), .size = sizeof(Conversion_Group_storage->Wait_time)},
+    {.offset = offsetof(struct Conversion_Group, Max_wait), .size = sizeof(Conversion_Group_storage->Max_wait)},
 } ;
 static struct pycca_class_portal const sio_class_portal[] = {
     {.storage = IO_Point_storage, .attrs = IO_Point_attr_portal, .mechClass = NULL, .numAttrs = 1, .numInsts = 11, .instSize = sizeof(struct IO_Point), .instOffset = 0, .isConst = 0, .hasCommon = 0, .initialState = IO_Point_INITIAL_STATE},
@@ -840,17 +1061,19 @@ static struct pycca_class_portal const sio_class_portal[] = {
     {.storage = IO_Point_storage, .attrs = Continuous_Point_attr_portal, .mechClass = NULL, .numAttrs = 1, .numInsts = 11, .instSize = sizeof(struct IO_Point), .instOffset = offsetof(struct IO_Point, R1.R1_Continuous_Point), .isConst = 0, .hasCommon = 0, .initialState = Continuous_Point_INITIAL_STATE},
     {.storage = IO_Point_storage, .attrs = Packed_Point_attr_portal, .mechClass = NULL, .numAttrs = 2, .numInsts = 11, .instSize = sizeof(struct IO_Point), .instOffset = offsetof(struct IO_Point, R1.R1_Discrete_Point.R8.R8_Packed_Point), .isConst = 0, .hasCommon = 0, .initialState = Packed_Point_INITIAL_STATE},
     {.storage = IO_Point_storage, .attrs = Control_Point_attr_portal, .mechClass = NULL, .numAttrs = 2, .numInsts = 11, .instSize = sizeof(struct IO_Point), .instOffset = offsetof(struct IO_Point, R1.R1_Discrete_Point.R8.R8_Control_Point), .isConst = 0, .hasCommon = 0, .initialState = Control_Point_INITIAL_STATE},
-    {.storage = IO_Point_storage, .attrs = Continuous_Input_Point_attr_portal, .mechClass = NULL, .numAttrs = 1, .numInsts = 11, .instSize = sizeof(struct IO_Point), .instOffset = offsetof(struct IO_Point, R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point), .isConst = 0, .hasCommon = 0, .initialState = Continuous_Input_Point_INITIAL_STATE},
-    {.storage = Point_Scaling_storage, .attrs = Point_Scaling_attr_portal, .mechClass = NULL, .numAttrs = 4, .numInsts = 2, .instSize = sizeof(struct Point_Scaling), .instOffset = 0, .isConst = 0, .hasCommon = 0, .initialState = Point_Scaling_INITIAL_STATE},
+    {.storage = IO_Point_storage, .attrs = Continuous_Input_Point_attr_portal, .mechClass = NULL, .numAttrs = 7, .numInsts = 11, .instSize = sizeof(struct IO_Point), .instOffset = offsetof(struct IO_Point, R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point), .isConst = 0, .hasCommon = 0, .initialState = Continuous_Input_Point_INITIAL_STATE},
+    {.storage = Point_Scaling_storage, .attrs = Point_Scaling_attr_portal, .mechClass = NULL, .numAttrs = 5, .numInsts = 2, .instSize = sizeof(struct Point_Scaling), .instOffset = 0, .isConst = 0, .hasCommon = 0, .initialState = Point_Scaling_INITIAL_STATE},
     {.storage = Point_Threshold_storage, .attrs = Point_Threshold_attr_portal, .mechClass = NULL, .numAttrs = 4, .numInsts = 6, .instSize = sizeof(struct Point_Threshold), .instOffset = 0, .isConst = 0, .hasCommon = 0, .initialState = Point_Threshold_INITIAL_STATE},
-    {.storage = Range_Limitation_storage, .attrs = Range_Limitation_attr_portal, .mechClass = &Range_Limitation_class, .numAttrs = 2, .numInsts = 9, .instSize = sizeof(struct Range_Limitation), .instOffset = 0, .isConst = 0, .hasCommon = 1, .initialState = Range_Limitation_INITIAL_STATE},
-    {.storage = Signal_Converter_storage, .attrs = Signal_Converter_attr_portal, .mechClass = &Signal_Converter_class, .numAttrs = 1, .numInsts = 1, .instSize = sizeof(struct Signal_Converter), .instOffset = 0, .isConst = 0, .hasCommon = 1, .initialState = Signal_Converter_INITIAL_STATE},
-    {.storage = Conversion_Group_storage, .attrs = Conversion_Group_attr_portal, .mechClass = &Conversion_Group_class, .numAttrs = 2, .numInsts = 3, .instSize = sizeof(struct Conversion_Group), .instOffset = 0, .isConst = 0, .hasCommon = 1, .initialState = Conversion_Group_INITIAL_STATE},
+    {.storage = Range_Limitation_storage, .attrs = NULL, .mechClass = &Range_Limitation_class, .numAttrs = 0, .numInsts = 9, .instSize = sizeof(struct Range_Limitation), .instOffset = 0, .isConst = 0, .hasCommon = 1, .initialState = Range_Limitation_INITIAL_STATE},
+    {.storage = Signal_Converter_storage, .attrs = Signal_Converter_attr_portal, .mechClass = &Signal_Converter_class, .numAttrs = 5, .numInsts = 1, .instSize = sizeof(struct Signal_Converter), .instOffset = 0, .isConst = 0, .hasCommon = 1, .initialState = Signal_Converter_INITIAL_STATE},
+    {.storage = Conversion_Group_storage, .attrs = Conversion_Group_attr_portal, .mechClass = &Conversion_Group_class, .numAttrs = 11, .numInsts = 3, .instSize = sizeof(struct Conversion_Group), .instOffset = 0, .isConst = 0, .hasCommon = 1, .initialState = Conversion_Group_INITIAL_STATE},
     {.storage = R6_Assigner_storage, .attrs = NULL, .mechClass = &R6_Assigner_class, .numAttrs = 0, .numInsts = 1, .instSize = sizeof(struct R6_Assigner), .instOffset = 0, .isConst = 0, .hasCommon = 1, .initialState = R6_Assigner_INITIAL_STATE},
+    {.storage = Debounce_Scanner_storage, .attrs = NULL, .mechClass = &Debounce_Scanner_class, .numAttrs = 0, .numInsts = 1, .instSize = sizeof(struct Debounce_Scanner), .instOffset = 0, .isConst = 0, .hasCommon = 1, .initialState = Debounce_Scanner_INITIAL_STATE},
+    {.storage = Sampling_Scheduler_storage, .attrs = NULL, .mechClass = &Sampling_Scheduler_class, .numAttrs = 0, .numInsts = 1, .instSize = sizeof(struct Sampling_Scheduler), .instOffset = 0, .isConst = 0, .hasCommon = 1, .initialState = Sampling_Scheduler_INITIAL_STATE},
 } ;
 struct pycca_domain_portal const sio_portal = {
     .classes = sio_class_portal,
-    .numClasses = 13
+    .numClasses = 15
 } ;
 
 /*
@@ -890,9 +1113,9 @@ static struct Continuous_Input_Point *const Conversion_Group_R4_48_refs[] = {
  * Initial Instance Storage for, "IO_Point"
  */
 static struct IO_Point IO_Point_storage[11] = {
-    {.R1__code = 2, .R1 = {.R1_Continuous_Point = {.R3 = &Point_Scaling_storage[1], .R2__code = 1, .R2 = {.R2_Continuous_Input_Point = {0, .R7 = Continuous_Input_Point_R7_28_refs, .R7__count = COUNTOF(Continuous_Input_Point_R7_28_refs), .R4 = &Conversion_Group_storage[0]}}}}},
-    {.R1__code = 2, .R1 = {.R1_Continuous_Point = {.R3 = &Point_Scaling_storage[0], .R2__code = 1, .R2 = {.R2_Continuous_Input_Point = {0, .R7 = Continuous_Input_Point_R7_29_refs, .R7__count = COUNTOF(Continuous_Input_Point_R7_29_refs), .R4 = &Conversion_Group_storage[1]}}}}},
-    {.R1__code = 2, .R1 = {.R1_Continuous_Point = {.R3 = &Point_Scaling_storage[1], .R2__code = 1, .R2 = {.R2_Continuous_Input_Point = {0, .R7 = Continuous_Input_Point_R7_30_refs, .R7__count = COUNTOF(Continuous_Input_Point_R7_30_refs), .R4 = &Conversion_Group_storage[2]}}}}},
+    {.R1__code = 2, .R1 = {.R1_Continuous_Point = {.R3 = &Point_Scaling_storage[1], .R2__code = 1, .R2 = {.R2_Continuous_Input_Point = {0, 0, 0, 0, false, 0, 0, .R7 = Continuous_Input_Point_R7_28_refs, .R7__count = COUNTOF(Continuous_Input_Point_R7_28_refs), .R4 = &Conversion_Group_storage[0]}}}}},
+    {.R1__code = 2, .R1 = {.R1_Continuous_Point = {.R3 = &Point_Scaling_storage[0], .R2__code = 1, .R2 = {.R2_Continuous_Input_Point = {0, 0, 0, 0, false, 0, 0, .R7 = Continuous_Input_Point_R7_29_refs, .R7__count = COUNTOF(Continuous_Input_Point_R7_29_refs), .R4 = &Conversion_Group_storage[1]}}}}},
+    {.R1__code = 2, .R1 = {.R1_Continuous_Point = {.R3 = &Point_Scaling_storage[1], .R2__code = 1, .R2 = {.R2_Continuous_Input_Point = {0, 0, 0, 0, false, 0, 0, .R7 = Continuous_Input_Point_R7_30_refs, .R7__count = COUNTOF(Continuous_Input_Point_R7_30_refs), .R4 = &Conversion_Group_storage[2]}}}}},
     {.R1__code = 0, .R1 = {.R1_Discrete_Point = {.R8__code = 1, .R8 = {.R8_Control_Point = {Memory, ReadWrite}}}}},
     {.R1__code = 0, .R1 = {.R1_Discrete_Point = {.R8__code = 1, .R8 = {.R8_Control_Point = {Memory, ReadWrite}}}}},
     {.R1__code = 0, .R1 = {.R1_Discrete_Point = {.R8__code = 1, .R8 = {.R8_Control_Point = {Memory, ReadWrite}}}}},
@@ -906,8 +1129,8 @@ static struct IO_Point IO_Point_storage[11] = {
  * Initial Instance Storage for, "Point_Scaling"
  */
 static struct Point_Scaling Point_Scaling_storage[2] = {
-    {1, 1, 0, ~0},
-    {1, 1, 0, ~0}
+    {1, 1, 0, ~0, 0},
+    {1, 1, 0, ~0, 0}
 } ;
 /*
  * Initial Instance Storage for, "Point_Threshold"
@@ -924,29 +1147,29 @@ static struct Point_Threshold Point_Threshold_storage[6] = {
  * Initial Instance Storage for, "Range_Limitation"
  */
 static struct Range_Limitation Range_Limitation_storage[9] = {
-    {.common_ = {1, 0, &Range_Limitation_class}, 0, 0, .R7_PT = &Point_Threshold_storage[0], .R7_CIP = &IO_Point_storage[0].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
-    {.common_ = {2, 0, &Range_Limitation_class}, 0, 0, .R7_PT = &Point_Threshold_storage[1], .R7_CIP = &IO_Point_storage[0].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
-    {.common_ = {3, 0, &Range_Limitation_class}, 0, 0, .R7_PT = &Point_Threshold_storage[2], .R7_CIP = &IO_Point_storage[0].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
-    {.common_ = {4, 0, &Range_Limitation_class}, 0, 0, .R7_PT = &Point_Threshold_storage[3], .R7_CIP = &IO_Point_storage[1].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
-    {.common_ = {5, 0, &Range_Limitation_class}, 0, 0, .R7_PT = &Point_Threshold_storage[4], .R7_CIP = &IO_Point_storage[1].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
-    {.common_ = {6, 0, &Range_Limitation_class}, 0, 0, .R7_PT = &Point_Threshold_storage[5], .R7_CIP = &IO_Point_storage[1].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
-    {.common_ = {7, 0, &Range_Limitation_class}, 0, 0, .R7_PT = &Point_Threshold_storage[0], .R7_CIP = &IO_Point_storage[2].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
-    {.common_ = {8, 0, &Range_Limitation_class}, 0, 0, .R7_PT = &Point_Threshold_storage[1], .R7_CIP = &IO_Point_storage[2].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
-    {.common_ = {9, 0, &Range_Limitation_class}, 0, 0, .R7_PT = &Point_Threshold_storage[2], .R7_CIP = &IO_Point_storage[2].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point}
+    {.common_ = {1, 0, &Range_Limitation_class}, .R7_PT = &Point_Threshold_storage[0], .R7_CIP = &IO_Point_storage[0].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
+    {.common_ = {2, 0, &Range_Limitation_class}, .R7_PT = &Point_Threshold_storage[1], .R7_CIP = &IO_Point_storage[0].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
+    {.common_ = {3, 0, &Range_Limitation_class}, .R7_PT = &Point_Threshold_storage[2], .R7_CIP = &IO_Point_storage[0].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
+    {.common_ = {4, 0, &Range_Limitation_class}, .R7_PT = &Point_Threshold_storage[3], .R7_CIP = &IO_Point_storage[1].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
+    {.common_ = {5, 0, &Range_Limitation_class}, .R7_PT = &Point_Threshold_storage[4], .R7_CIP = &IO_Point_storage[1].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
+    {.common_ = {6, 0, &Range_Limitation_class}, .R7_PT = &Point_Threshold_storage[5], .R7_CIP = &IO_Point_storage[1].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
+    {.common_ = {7, 0, &Range_Limitation_class}, .R7_PT = &Point_Threshold_storage[0], .R7_CIP = &IO_Point_storage[2].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
+    {.common_ = {8, 0, &Range_Limitation_class}, .R7_PT = &Point_Threshold_storage[1], .R7_CIP = &IO_Point_storage[2].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point},
+    {.common_ = {9, 0, &Range_Limitation_class}, .R7_PT = &Point_Threshold_storage[2], .R7_CIP = &IO_Point_storage[2].R1.R1_Continuous_Point.R2.R2_Continuous_Input_Point}
 } ;
 /*
  * Initial Instance Storage for, "Signal_Converter"
  */
 static struct Signal_Converter Signal_Converter_storage[1] = {
-    {.common_ = {1, 0, &Signal_Converter_class}, true, .R5 = Signal_Converter_R5_49_refs, .R5__count = COUNTOF(Signal_Converter_R5_49_refs), .R6 = NULL, .assigner = &R6_Assigner_storage[0]}
+    {.common_ = {1, 0, &Signal_Converter_class}, true, 0, 0, 0, 0, .R5 = Signal_Converter_R5_49_refs, .R5__count = COUNTOF(Signal_Converter_R5_49_refs), .R6 = NULL, .assigner = &R6_Assigner_storage[0]}
 } ;
 /*
  * Initial Instance Storage for, "Conversion_Group"
  */
 static struct Conversion_Group Conversion_Group_storage[3] = {
-    {.common_ = {1, 0, &Conversion_Group_class}, false, 500, .R4 = Conversion_Group_R4_46_refs, .R4__count = COUNTOF(Conversion_Group_R4_46_refs), .R5 = &Signal_Converter_storage[0]},
-    {.common_ = {2, 0, &Conversion_Group_class}, false, 500, .R4 = Conversion_Group_R4_47_refs, .R4__count = COUNTOF(Conversion_Group_R4_47_refs), .R5 = &Signal_Converter_storage[0]},
-    {.common_ = {3, 0, &Conversion_Group_class}, false, 500, .R4 = Conversion_Group_R4_48_refs, .R4__count = COUNTOF(Conversion_Group_R4_48_refs), .R5 = &Signal_Converter_storage[0]}
+    {.common_ = {1, 0, &Conversion_Group_class}, false, 500, false, false, 0, 0, 0, 0, 0, 0, 0, .R4 = Conversion_Group_R4_46_refs, .R4__count = COUNTOF(Conversion_Group_R4_46_refs), .R5 = &Signal_Converter_storage[0]},
+    {.common_ = {2, 0, &Conversion_Group_class}, false, 500, false, false, 0, 0, 0, 0, 0, 0, 0, .R4 = Conversion_Group_R4_47_refs, .R4__count = COUNTOF(Conversion_Group_R4_47_refs), .R5 = &Signal_Converter_storage[0]},
+    {.common_ = {3, 0, &Conversion_Group_class}, false, 500, false, false, 0, 0, 0, 0, 0, 0, 0, .R4 = Conversion_Group_R4_48_refs, .R4__count = COUNTOF(Conversion_Group_R4_48_refs), .R5 = &Signal_Converter_storage[0]}
 } ;
 /*
  * Initial Instance Storage for, "R6_Assigner"
@@ -954,32 +1177,140 @@ static struct Conversion_Group Conversion_Group_storage[3] = {
 static struct R6_Assigner R6_Assigner_storage[1] = {
     {.common_ = {1, 0, &R6_Assigner_class}, .idclass = &Signal_Converter_storage[0]}
 } ;
+/*
+ * Initial Instance Storage for, "Debounce_Scanner"
+ */
+static struct Debounce_Scanner Debounce_Scanner_storage[1] = {
+    {.common_ = {1, 0, &Debounce_Scanner_class}}
+} ;
+/*
+ * Initial Instance Storage for, "Sampling_Scheduler"
+ */
+static struct Sampling_Scheduler Sampling_Scheduler_storage[1] = {
+    {.common_ = {1, 0, &Sampling_Scheduler_class}}
+} ;
 
 /*
  * Operation Function Definitions
  */
 #define THISCLASS__ Continuous_Input_Point
+static void Continuous_Input_Point_checkThresholds(struct Continuous_Input_Point *self)
+{
+    INSTR_FUNC("sio.Continuous_Input_Point.checkThresholds") ;
+
+    if (!thresholds.loaded) {
+        ClassOp(Continuous_Input_Point, loadThresholds)() ;
+    }
+
+    sio_Point_ID ptid = PYCCA_idOfRef(IO_Point,
+        PYCCA_unionSupertype(PYCCA_unionSupertype(self, Continuous_Point, R2),
+            IO_Point, R1)) ;
+    unsigned first = thresholds.points[ptid].first ;
+    unsigned last = first + thresholds.points[ptid].count ;
+    sio_Point_Value value = self->Value ;
+
+    bool changed = false ;
+    for (unsigned i = first ; i < last ; i++) {
+        struct Point_Threshold const *pt = thresholds.threshold[i] ;
+        bool beyond = (value > pt->Limit) != (pt->Direction == Falling) ;
+        bool out = thresholds.outOfRange[i] ;
+        Count count = beyond != out ? thresholds.count[i] + 1 : 0 ;
+        thresholds.count[i] = count ;
+        changed |= count != 0 &&
+                count >= (out ? pt->Under_limit : pt->Over_limit) ;
+    }
+    if (!changed) {
+        return ;
+    }
+
+    for (unsigned i = first ; i < last ; i++) {
+        struct Point_Threshold const *pt = thresholds.threshold[i] ;
+        Count count = thresholds.count[i] ;
+        bool out = thresholds.outOfRange[i] ;
+        if (count == 0 ||
+                count < (out ? pt->Under_limit : pt->Over_limit)) {
+            continue ;
+        }
+        out = !out ;
+        thresholds.outOfRange[i] = out ;
+        thresholds.count[i] = 0 ;
+
+        ClassRefVar(Range_Limitation, rl) = PYCCA_refOfId(Range_Limitation,
+                thresholds.limitation[i]) ;
+        if (out) {
+            PYCCA_generate(Out_of_range, Range_Limitation, rl, self) ;
+        } else {
+            PYCCA_generate(In_range, Range_Limitation, rl, self) ;
+        }
+    }
+}
+static void Continuous_Input_Point_loadThresholds(void)
+{
+    INSTR_FUNC("sio.Continuous_Input_Point.loadThresholds") ;
+
+    unsigned slot = 0 ;
+    ClassRefVar(Continuous_Input_Point, cip) ;
+    ClassRefVar(IO_Point, iop) ;
+    PYCCA_forAllInst(iop, IO_Point) {
+        sio_Point_ID ptid = PYCCA_idOfRef(IO_Point, iop) ;
+        thresholds.points[ptid].first = slot ;
+        thresholds.points[ptid].count = 0 ;
+        if (iop->SubCodeMember(R1) !=
+                SubCodeValue(IO_Point, R1, Continuous_Point)) {
+            continue ;
+        }
+        ClassRefVar(Continuous_Point, cpt) = PYCCA_unionSubtype(iop, R1,
+                Continuous_Point) ;
+        if (cpt->SubCodeMember(R2) !=
+                SubCodeValue(Continuous_Point, R2, Continuous_Input_Point)) {
+            continue ;
+        }
+        cip = PYCCA_unionSubtype(cpt, R2, Continuous_Input_Point) ;
+
+        ClassRefConstSetVar(Range_Limitation, rlset) ;
+        PYCCA_forAllRelated(rlset, cip, R7) {
+            ClassRefVar(Range_Limitation, rl) = *rlset ;
+            ClassRefVar(Point_Threshold, pt) = rl->R7_PT ;
+            assert(slot < COUNTOF(thresholds.threshold)) ;
+
+            thresholds.threshold[slot] = pt ;
+            thresholds.outOfRange[slot] = false ;
+            thresholds.count[slot] = 0 ;
+            thresholds.limitation[slot] = PYCCA_idOfRef(Range_Limitation, rl) ;
+            slot++ ;
+            thresholds.points[ptid].count++ ;
+        }
+    }
+    thresholds.loaded = true ;
+}
+#undef THISCLASS__
+#define THISCLASS__ Continuous_Input_Point
 static void Continuous_Input_Point_updateValue(struct Continuous_Input_Point *self, sio_Point_Value value)
 {
     INSTR_FUNC("sio.Continuous_Input_Point.updateValue") ;
 
     ClassRefVar(Continuous_Point, cpt) = PYCCA_unionSupertype(self, Continuous_Point, R2) ;
-    ClassRefVar(Point_Scaling, ps) = cpt->R3 ;
-    assert(ps != NULL) ;
-    self->Value = InstOp(Point_Scaling, scaleValueIn)(ps, value) ;
-
-    ClassRefVar(IO_Point, iop) = PYCCA_unionSupertype(cpt, IO_Point, R1) ;
-    ExternalOp(NOTIFY_New_point_value)(
-        PYCCA_idOfRef(IO_Point, iop), self->Value) ;
-
-    ClassRefConstSetVar(Range_Limitation, tdset) ;
-    PYCCA_forAllRelated(tdset, self, R7) {
-        ClassRefVar(Range_Limitation, td) = *tdset ;
-        MechEcb np = PYCCA_newEvent(New_point, Range_Limitation, td, self) ;
-        PYCCA_eventParam(np, Range_Limitation, New_point, pointValue) =
-            self->Value ;
-        PYCCA_postEvent(np) ;
+    self->Value = value ;
+
+    Msec now = (Msec)(mechNow() / 1000) ;
+    sio_Point_Value change = value - self->Notified_value ;
+    if (change < 0) {
+        change = -change ;
     }
+    if (!self->Notified || (change > cpt->R3->Deadband &&
+            (Msec)(now - self->Notified_at) >= self->Notify_interval)) {
+        ClassRefVar(IO_Point, iop) = PYCCA_unionSupertype(cpt, IO_Point, R1) ;
+        ExternalOp(NOTIFY_New_point_value)(
+            PYCCA_idOfRef(IO_Point, iop), self->Value) ;
+        self->Notified_value = value ;
+        self->Notified_at = now ;
+        self->Notified = true ;
+        self->Forwarded_count++ ;
+    } else {
+        self->Suppressed_count++ ;
+    }
+
+    ThisClassInstOp(checkThresholds)(self) ;
 }
 #undef THISCLASS__
 #define THISCLASS__ Continuous_Point
@@ -1007,32 +1338,35 @@ static void Continuous_Point_writePoint(struct Continuous_Point *self, sio_Point
      */
 }
 #undef THISCLASS__
-#define THISCLASS__ Continuous_Point
-static sio_Point_Value Continuous_Point_readPoint(struct Continuous_Point *self)
+#define THISCLASS__ Control_Point
+static void Control_Point_flushShadows(void)
 {
-    INSTR_FUNC("sio.Continuous_Point.readPoint") ;
-
-    assert(PYCCA_isSubtypeRelated(self, Continuous_Point, R2,
-            Continuous_Output_Point) ||
-        PYCCA_isSubtypeRelated(self, Continuous_Point, R2,
-            Continuous_Input_Point)) ;
-
-    return PYCCA_isSubtypeRelated(self, Continuous_Point, R2,
-            Continuous_Input_Point) ?
-        PYCCA_unionSubtype(self, R2, Continuous_Input_Point)->Value : 0 ;
+    INSTR_FUNC("sio.Control_Point.flushShadows") ;
+
+    for (unsigned pid = 0 ; pid < COUNTOF(shadow.dirty) ; pid++) {
+        if (shadow.dirty[pid]) {
+            shadow.dirty[pid] = false ;
+            ClassRefVar(Control_Point, ctpt) = shadow.point[pid] ;
+            if (ctpt->Access != ReadOnly) {
+                ExternalOp(DEVICE_Write_reg)(pid, shadow.image[pid]) ;
+            }
+        }
+    }
 }
-#undef THISCLASS__
-#define THISCLASS__ Control_Point
 static sio_Point_Value Control_Point_readPoint(struct Control_Point *self)
 {
     INSTR_FUNC("sio.Control_Point.readPoint") ;
 
+    sio_Point_ID pid =
+        PYCCA_idOfRef(IO_Point,
+        PYCCA_unionSupertype(PYCCA_unionSupertype(self, Discrete_Point, R8),
+            IO_Point, R1)) ;
+    if (shadow.dirty[pid]) {
+        return shadow.image[pid] ;
+    }
+
     sio_Point_Value value = 0 ;
     if (self->Access != WriteOnly) {
-        sio_Point_ID pid =
-            PYCCA_idOfRef(IO_Point,
-            PYCCA_unionSupertype(PYCCA_unionSupertype(self, Discrete_Point, R8),
-                IO_Point, R1)) ;
         value = ExternalOp(DEVICE_Read_reg)(pid) ;
     }
 
@@ -1044,135 +1378,161 @@ static void Control_Point_writePoint(struct Control_Point *self, sio_Point_Value
 {
     INSTR_FUNC("sio.Control_Point.writePoint") ;
 
-    if (self->Access != ReadOnly) {
-        sio_Point_ID pid =
-            PYCCA_idOfRef(IO_Point,
-            PYCCA_unionSupertype(PYCCA_unionSupertype(self, Discrete_Point, R8),
-                IO_Point, R1)) ;
-        ExternalOp(DEVICE_Write_reg)(pid, value) ;
-    }
+    ThisClassInstOp(writeField)(self, ~0, value) ;
 }
 #undef THISCLASS__
-#define THISCLASS__ Discrete_Point
-static sio_Point_Value Discrete_Point_readPoint(struct Discrete_Point *self)
+#define THISCLASS__ Control_Point
+static void Control_Point_writeField(struct Control_Point *self, sio_Point_Value mask, sio_Point_Value value)
 {
-    INSTR_FUNC("sio.Discrete_Point.readPoint") ;
-
-    assert(PYCCA_isSubtypeRelated(self, Discrete_Point, R8, Packed_Point) ||
-            PYCCA_isSubtypeRelated(self, Discrete_Point, R8, Control_Point)) ;
-
-    switch (self->SubCodeMember(R8)) {
-    case SubCodeValue(Discrete_Point, R8, Packed_Point):
-        return InstOp(Packed_Point, readPoint)(
-                PYCCA_unionSubtype(self, R8, Packed_Point)) ;
+    INSTR_FUNC("sio.Control_Point.writeField") ;
 
-    case SubCodeValue(Discrete_Point, R8, Control_Point):
-        return InstOp(Control_Point, readPoint)(
-                PYCCA_unionSubtype(self, R8, Control_Point)) ;
-
-    default:
-        return 0 ;
+    sio_Point_ID pid =
+        PYCCA_idOfRef(IO_Point,
+        PYCCA_unionSupertype(PYCCA_unionSupertype(self, Discrete_Point, R8),
+            IO_Point, R1)) ;
+    if (!shadow.dirty[pid]) {
+        switch (self->Memory_model) {
+        case Memory:
+        default:
+            shadow.image[pid] = mask == ~0 ?
+                    0 : ThisClassInstOp(readPoint)(self) ;
+            break ;
+
+        case ReadClear:
+            shadow.image[pid] = 0 ;
+            break ;
+
+        case ReadClearZero:
+            shadow.image[pid] = ~0 ;
+            break ;
+        }
+        shadow.dirty[pid] = true ;
+        shadow.point[pid] = self ;
+        mechDeferToStepEnd(ClassOp(Control_Point, flushShadows)) ;
     }
+
+    shadow.image[pid] = (shadow.image[pid] & ~mask) | (value & mask) ;
 }
 #undef THISCLASS__
-#define THISCLASS__ Discrete_Point
-static void Discrete_Point_writePoint(struct Discrete_Point *self, sio_Point_Value value)
+#define THISCLASS__ Conversion_Group
+static void Conversion_Group_schedule(struct Conversion_Group *self)
 {
-    INSTR_FUNC("sio.Discrete_Point.writePoint") ;
-
-    assert(PYCCA_isSubtypeRelated(self, Discrete_Point, R8, Packed_Point) ||
-            PYCCA_isSubtypeRelated(self, Discrete_Point, R8, Control_Point)) ;
-
-    switch (self->SubCodeMember(R8)) {
-    case SubCodeValue(Discrete_Point, R8, Packed_Point):
-        InstOp(Packed_Point, writePoint)(PYCCA_unionSubtype(self, R8,
-                Packed_Point), value) ;
-        break ;
-
-    case SubCodeValue(Discrete_Point, R8, Control_Point):
-        InstOp(Control_Point, writePoint)(PYCCA_unionSubtype(self, R8,
-                Control_Point), value) ;
-        break ;
-
-    // N.B. no default
-    }
+    INSTR_FUNC("sio.Conversion_Group.schedule") ;
+
+    self->Scheduled = true ;
+    self->Sample_pending = false ;
+    self->Next_sample = (Msec)(mechNow() / 1000) + self->Period ;
+    PYCCA_generate(Start, Sampling_Scheduler,
+        PYCCA_refOfId(Sampling_Scheduler,
+            SIO_SAMPLING_SCHEDULER_SMPSCHED1_INST_ID), self) ;
 }
 #undef THISCLASS__
 #define THISCLASS__ IO_Point
-static void IO_Point_writePoint(struct IO_Point *self, sio_Point_Value value)
+static Point_Accessor * IO_Point_accessor(struct IO_Point *self)
 {
-    INSTR_FUNC("sio.IO_Point.writePoint") ;
+    INSTR_FUNC("sio.IO_Point.accessor") ;
 
-    assert(PYCCA_isSubtypeRelated(self, IO_Point, R1, Discrete_Point) ||
-            PYCCA_isSubtypeRelated(self, IO_Point, R1, Continuous_Point)) ;
+    static bool resolved = false ;
+    if (!resolved) {
+        ClassRefVar(IO_Point, iop) ;
+        PYCCA_forAllInst(iop, IO_Point) {
+            ThisClassInstOp(resolveAccessor)(iop) ;
+        }
+        resolved = true ;
+    }
+    return pointAccessors + PYCCA_idOfSelf ;
+}
+static sio_Point_Value IO_Point_readPoint(struct IO_Point *self)
+{
+    INSTR_FUNC("sio.IO_Point.readPoint") ;
 
-    switch (self->SubCodeMember(R1)) {
-    case SubCodeValue(IO_Point, R1, Discrete_Point):
-        InstOp(Discrete_Point, writePoint)(
-            PYCCA_unionSubtype(self, R1, Discrete_Point), value) ;
-        break ;
+    Point_Accessor *acc = ThisClassInstOp(accessor)(self) ;
 
-    case SubCodeValue(IO_Point, R1, Continuous_Point):
-        InstOp(Continuous_Point, writePoint)(
-            PYCCA_unionSubtype(self, R1, Continuous_Point), value) ;
-        break ;
+    switch (acc->leaf) {
+    case Leaf_Packed_Point:
+        return InstOp(Packed_Point, readPoint)(acc->ref) ;
 
-    // N.B. no default
+    case Leaf_Control_Point:
+        return InstOp(Control_Point, readPoint)(acc->ref) ;
+
+    case Leaf_Signalling_Point:
+        return InstOp(Signalling_Point, readPoint)(acc->ref) ;
+
+    case Leaf_Continuous_Input_Point:
+        return ((struct Continuous_Input_Point *)acc->ref)->Value ;
+
+    default:
+        return 0 ;
     }
 }
-#undef THISCLASS__
-#define THISCLASS__ IO_Point
-static sio_Point_Value IO_Point_readPoint(struct IO_Point *self)
+static void IO_Point_resolveAccessor(struct IO_Point *self)
 {
-    INSTR_FUNC("sio.IO_Point.readPoint") ;
+    INSTR_FUNC("sio.IO_Point.resolveAccessor") ;
 
-    assert(PYCCA_isSubtypeRelated(self, IO_Point, R1, Discrete_Point) ||
-            PYCCA_isSubtypeRelated(self, IO_Point, R1, Continuous_Point)) ;
+    Point_Accessor *acc = pointAccessors + PYCCA_idOfSelf ;
 
     switch (self->SubCodeMember(R1)) {
-    case SubCodeValue(IO_Point, R1, Discrete_Point):
-        return InstOp(Discrete_Point, readPoint)(
-                PYCCA_unionSubtype(self, R1, Discrete_Point)) ;
+    case SubCodeValue(IO_Point, R1, Discrete_Point): {
+        ClassRefVar(Discrete_Point, dpt) = PYCCA_unionSubtype(self, R1,
+                Discrete_Point) ;
+        if (PYCCA_isSubtypeRelated(dpt, Discrete_Point, R8, Packed_Point)) {
+            acc->leaf = Leaf_Packed_Point ;
+            acc->ref = PYCCA_unionSubtype(dpt, R8, Packed_Point) ;
+        } else {
+            acc->leaf = Leaf_Control_Point ;
+            acc->ref = PYCCA_unionSubtype(dpt, R8, Control_Point) ;
+        }
+        break ;
+    }
 
     case SubCodeValue(IO_Point, R1, Signalling_Point):
-        return InstOp(Signalling_Point, readPoint)(
-                PYCCA_unionSubtype(self, R1, Signalling_Point)) ;
+        acc->leaf = Leaf_Signalling_Point ;
+        acc->ref = PYCCA_unionSubtype(self, R1, Signalling_Point) ;
+        break ;
 
-    case SubCodeValue(IO_Point, R1, Continuous_Point):
-        return InstOp(Continuous_Point, readPoint)(
-                PYCCA_unionSubtype(self, R1, Continuous_Point)) ;
+    case SubCodeValue(IO_Point, R1, Continuous_Point): {
+        ClassRefVar(Continuous_Point, cpt) = PYCCA_unionSubtype(self, R1,
+                Continuous_Point) ;
+        if (PYCCA_isSubtypeRelated(cpt, Continuous_Point, R2,
+                Continuous_Input_Point)) {
+            acc->leaf = Leaf_Continuous_Input_Point ;
+            acc->ref = PYCCA_unionSubtype(cpt, R2, Continuous_Input_Point) ;
+        } else {
+            acc->leaf = Leaf_Continuous_Output_Point ;
+            acc->ref = cpt ;
+        }
+        break ;
+    }
 
     default:
-        return 0 ;
+        assert(false) ;
+        break ;
     }
 }
 #undef THISCLASS__
-#define THISCLASS__ Packed_Point
-static void Packed_Point_writePoint(struct Packed_Point *self, sio_Point_Value value)
+#define THISCLASS__ IO_Point
+static void IO_Point_writePoint(struct IO_Point *self, sio_Point_Value value)
 {
-    INSTR_FUNC("sio.Packed_Point.writePoint") ;
+    INSTR_FUNC("sio.IO_Point.writePoint") ;
 
-    sio_Point_Value mask = ((1 << self->Length) - 1) << self->Offset ;
-    ClassRefVar(Control_Point, ctpt) = self->R9 ;
-    assert(ctpt != NULL) ;
-    sio_Point_Value base ;
-    switch (ctpt->Memory_model) {
-    case Memory:
-    default:
-        base = InstOp(Control_Point, readPoint)(ctpt) & ~mask ;
+    Point_Accessor *acc = ThisClassInstOp(accessor)(self) ;
+
+    switch (acc->leaf) {
+    case Leaf_Packed_Point:
+        InstOp(Packed_Point, writePoint)(acc->ref, value) ;
         break ;
 
-    case ReadClear:
-        base = 0 ;
+    case Leaf_Control_Point:
+        InstOp(Control_Point, writePoint)(acc->ref, value) ;
         break ;
 
-    case ReadClearZero:
-        base = ~0 ;
+    case Leaf_Continuous_Output_Point:
+        InstOp(Continuous_Point, writePoint)(acc->ref, value) ;
         break ;
-    }
 
-    InstOp(Control_Point, writePoint)(ctpt,
-            ((value << self->Offset) & mask) | base) ;
+    default:
+        break ;
+    }
 }
 #undef THISCLASS__
 #define THISCLASS__ Packed_Point
@@ -1187,21 +1547,18 @@ static sio_Point_Value Packed_Point_readPoint(struct Packed_Point *self)
     return (value >> self->Offset) & mask ;
 }
 #undef THISCLASS__
-#define THISCLASS__ Point_Scaling
-static sio_Point_Value Point_Scaling_scaleValueIn(struct Point_Scaling *self, sio_Point_Value value)
+#define THISCLASS__ Packed_Point
+static void Packed_Point_writePoint(struct Packed_Point *self, sio_Point_Value value)
 {
-    INSTR_FUNC("sio.Point_Scaling.scaleValueIn") ;
+    INSTR_FUNC("sio.Packed_Point.writePoint") ;
 
-    /*
-     * Convert, rounding to deal with division truncation.
-     */
-    sio_Point_Value in = ((value * self->Multiplier + self->Divisor / 2) /
-            self->Divisor) + self->Intercept ;
-    if (in > self->Mask) {
-        in = self->Mask ;
-    }
-    return in ;
+    sio_Point_Value mask = ((1 << self->Length) - 1) << self->Offset ;
+    ClassRefVar(Control_Point, ctpt) = self->R9 ;
+    assert(ctpt != NULL) ;
+    InstOp(Control_Point, writeField)(ctpt, mask, value << self->Offset) ;
 }
+#undef THISCLASS__
+#define THISCLASS__ Point_Scaling
 static sio_Point_Value Point_Scaling_scaleValueOut(struct Point_Scaling *self, sio_Point_Value value)
 {
     INSTR_FUNC("sio.Point_Scaling.scaleValueOut") ;
@@ -1220,7 +1577,75 @@ static sio_Point_Value Point_Scaling_scaleValueOut(struct Point_Scaling *self, s
     return out ;
 }
 #undef THISCLASS__
+#define THISCLASS__ Point_Scaling
+static void Point_Scaling_scaleValuesIn(Scaling_Vector *sv, unsigned count)
+{
+    INSTR_FUNC("sio.Point_Scaling.scaleValuesIn") ;
+
+    assert(count <= COUNTOF(sv->values)) ;
+
+    for (unsigned i = 0 ; i < count ; i++) {
+        /*
+         * Convert, rounding to deal with division truncation.
+         */
+        sio_Point_Value in = ((sv->values[i] * sv->multiplier[i] +
+                sv->divisor[i] / 2) / sv->divisor[i]) + sv->intercept[i] ;
+        sv->values[i] = (Point_Value_Mask)in > sv->mask[i] ?
+                (sio_Point_Value)sv->mask[i] : in ;
+    }
+}
+#undef THISCLASS__
+#define THISCLASS__ R6_Assigner
+static struct Conversion_Group * R6_Assigner_nextReady(struct R6_Assigner *self, bool take)
+{
+    INSTR_FUNC("sio.R6_Assigner.nextReady") ;
+
+    Ready_Queue *rq = readyQueues +
+            PYCCA_idOfRef(Signal_Converter, self->idclass) ;
+    while (rq->count != 0) {
+        ClassRefVar(Conversion_Group, cg) = rq->groups[rq->head] ;
+        bool discard = !cg->Waiting_for_converter ;
+        if (discard || take) {
+            rq->head = (rq->head + 1) % COUNTOF(rq->groups) ;
+            rq->count-- ;
+            queued[PYCCA_idOfRef(Conversion_Group, cg)] = false ;
+        }
+        if (!discard) {
+            return cg ;
+        }
+    }
+    return NULL ;
+}
+#undef THISCLASS__
+#define THISCLASS__ R6_Assigner
+static void R6_Assigner_enqueue(struct R6_Assigner *self, struct Conversion_Group *cg)
+{
+    INSTR_FUNC("sio.R6_Assigner.enqueue") ;
+
+    unsigned cgid = PYCCA_idOfRef(Conversion_Group, cg) ;
+    if (queued[cgid]) {
+        return ;
+    }
+    Ready_Queue *rq = readyQueues +
+            PYCCA_idOfRef(Signal_Converter, self->idclass) ;
+    assert(rq->count < COUNTOF(rq->groups)) ;
+    unsigned tail = (rq->head + rq->count++) % COUNTOF(rq->groups) ;
+    rq->groups[tail] = cg ;
+    queued[cgid] = true ;
+}
+#undef THISCLASS__
 #define THISCLASS__ Signalling_Point
+static void Signalling_Point_cancelDebounce(struct Signalling_Point *self)
+{
+    INSTR_FUNC("sio.Signalling_Point.cancelDebounce") ;
+
+    unsigned slot = PYCCA_idOfRef(IO_Point,
+            PYCCA_unionSupertype(self, IO_Point, R1)) ;
+    if (debounce.pending[slot]) {
+        debounce.pending[slot] = false ;
+        debounce.pendingCount-- ;
+    }
+}
 static void Signalling_Point_evalSignal(struct Signalling_Point *self)
 {
     INSTR_FUNC("sio.Signalling_Point.evalSignal") ;
@@ -1247,6 +1672,23 @@ static sio_Point_Value Signalling_Point_readPoint(struct Signalling_Point *self)
         PYCCA_idOfRef(IO_Point, PYCCA_unionSupertype(self, IO_Point, R1)) ;
     return ExternalOp(DEVICE_Read_reg)(pid) ;
 }
+static void Signalling_Point_startDebounce(struct Signalling_Point *self)
+{
+    INSTR_FUNC("sio.Signalling_Point.startDebounce") ;
+
+    unsigned slot = PYCCA_idOfRef(IO_Point,
+            PYCCA_unionSupertype(self, IO_Point, R1)) ;
+    debounce.edge[slot] = debounce.clock + DEBOUNCE_SCAN_PERIOD ;
+    if (!debounce.pending[slot]) {
+        debounce.pending[slot] = true ;
+        debounce.point[slot] = self ;
+        if (debounce.pendingCount++ == 0) {
+            PYCCA_generate(Start, Debounce_Scanner,
+                PYCCA_refOfId(Debounce_Scanner,
+                    SIO_DEBOUNCE_SCANNER_DBSCAN1_INST_ID), self) ;
+        }
+    }
+}
 #undef THISCLASS__
 
 /*
@@ -1267,6 +1709,8 @@ static void Conversion_Group_FINISHED(void *const s_, void *const p_)
     INSTR_FUNC("sio.Conversion_Group.FINISHED") ;
     struct Conversion_Group *const self = (struct Conversion_Group *)s_ ;
 
+    self->Scheduled = false ;
+    self->Sample_pending = false ;
     PYCCA_cancelDelayedToSelf(Sample) ;
     self->Waiting_for_converter = false ;
 #undef THISSTATE__
@@ -1277,9 +1721,16 @@ static void Conversion_Group_WAITING_FOR_CONVERSION(void *const s_, void *const
     INSTR_FUNC("sio.Conversion_Group.WAITING_FOR_CONVERSION") ;
     struct Conversion_Group *const self = (struct Conversion_Group *)s_ ;
 
-    self->Waiting_for_converter = true ;
-    ClassRefVar(R6_Assigner, r6asgn) = self->R5->assigner ;
-    PYCCA_generate(Group_ready, R6_Assigner, r6asgn, self) ;
+    if (!self->Scheduled && self->Period != 0) {
+        ThisClassInstOp(schedule)(self) ;
+    }
+    if (!self->Waiting_for_converter) {
+        self->Waiting_for_converter = true ;
+        self->Ready_at = (Msec)(mechNow() / 1000) ;
+        ClassRefVar(R6_Assigner, r6asgn) = self->R5->assigner ;
+        InstOp(R6_Assigner, enqueue)(r6asgn, self) ;
+        PYCCA_generate(Group_ready, R6_Assigner, r6asgn, self) ;
+    }
 #undef THISSTATE__
 }
 static void Conversion_Group_CONVERSION_COMPLETED(void *const s_, void *const p_)
@@ -1288,8 +1739,58 @@ static void Conversion_Group_CONVERSION_COMPLETED(void *const s_, void *const p_
     INSTR_FUNC("sio.Conversion_Group.CONVERSION_COMPLETED") ;
     struct Conversion_Group *const self = (struct Conversion_Group *)s_ ;
 
-    if (self->Period != 0) {
-        PYCCA_generateDelayedToSelf(Sample, self->Period) ;
+    self->Sample_pending = false ;
+#undef THISSTATE__
+}
+#undef THISCLASS__
+#define THISCLASS__ Debounce_Scanner
+static void Debounce_Scanner_IDLE(void *const s_, void *const p_)
+{
+#define THISSTATE__ IDLE
+    INSTR_FUNC("sio.Debounce_Scanner.IDLE") ;
+
+#undef THISSTATE__
+}
+static void Debounce_Scanner_STARTING(void *const s_, void *const p_)
+{
+#define THISSTATE__ STARTING
+    INSTR_FUNC("sio.Debounce_Scanner.STARTING") ;
+    struct Debounce_Scanner *const self = (struct Debounce_Scanner *)s_ ;
+
+    GeneratePeriodicToSelf(Scan, self, DEBOUNCE_SCAN_PERIOD) ;
+#undef THISSTATE__
+}
+static void Debounce_Scanner_WAITING(void *const s_, void *const p_)
+{
+#define THISSTATE__ WAITING
+    INSTR_FUNC("sio.Debounce_Scanner.WAITING") ;
+
+#undef THISSTATE__
+}
+static void Debounce_Scanner_SCANNING(void *const s_, void *const p_)
+{
+#define THISSTATE__ SCANNING
+    INSTR_FUNC("sio.Debounce_Scanner.SCANNING") ;
+    struct Debounce_Scanner *const self = (struct Debounce_Scanner *)s_ ;
+
+    debounce.clock += DEBOUNCE_SCAN_PERIOD ;
+
+    for (unsigned slot = 0 ; slot < COUNTOF(debounce.pending) ; slot++) {
+        ClassRefVar(Signalling_Point, spt) = debounce.point[slot] ;
+        if (debounce.pending[slot] &&
+                (Msec)(debounce.clock - debounce.edge[slot]) >=
+                    spt->Debounce_time) {
+            debounce.pending[slot] = false ;
+            debounce.pendingCount-- ;
+            PYCCA_generate(Confirm, Signalling_Point, spt, spt) ;
+        }
+    }
+
+    if (debounce.pendingCount == 0) {
+        PYCCA_cancelDelayedToSelf(Scan) ;
+        PYCCA_generateToSelf(Stop) ;
+    } else {
+        PYCCA_generateToSelf(Continue) ;
     }
 #undef THISSTATE__
 }
@@ -1301,15 +1802,8 @@ static void R6_Assigner_WAITING_FOR_GROUP(void *const s_, void *const p_)
     INSTR_FUNC("sio.R6_Assigner.WAITING_FOR_GROUP") ;
     struct R6_Assigner *const self = (struct R6_Assigner *)s_ ;
 
-    ClassRefVar(Signal_Converter, sc) = self->idclass ;
-
-    ClassRefConstSetVar(Conversion_Group, cgset) ;
-    PYCCA_forAllRelated(cgset, sc, R5) {
-        ClassRefVar(Conversion_Group, cg) = *cgset ;
-        if (cg->Waiting_for_converter) {
-            PYCCA_generateToSelf(Group_ready) ;
-            return ;
-        }
+    if (ThisClassInstOp(nextReady)(self, false) != NULL) {
+        PYCCA_generateToSelf(Group_ready) ;
     }
 #undef THISSTATE__
 }
@@ -1333,67 +1827,29 @@ static void R6_Assigner_Assigning_Converter(void *const s_, void *const p_)
 
     ClassRefVar(Signal_Converter, sc) = self->idclass ;
     assert(sc->Converter_available) ;
-    ClassRefConstSetVar(Conversion_Group, cgset) ;
-    PYCCA_forAllRelated(cgset, sc, R5) {
-        ClassRefVar(Conversion_Group, cg) = *cgset ;
-        if (cg->Waiting_for_converter) {
-            sc->R6 = cg ;
-
-            sc->Converter_available = false ;
-            cg->Waiting_for_converter = false ;
-            PYCCA_generateToSelf(Converter_assigned) ;
-            PYCCA_generate(Converter_assigned, Signal_Converter, sc, self) ;
-            return ;
-        }
+    ClassRefVar(Conversion_Group, cg) = ThisClassInstOp(nextReady)(self,
+            true) ;
+    PYCCA_generateToSelf(Converter_assigned) ;
+    if (cg == NULL) {
+        return ;
     }
-#undef THISSTATE__
-}
-#undef THISCLASS__
-#define THISCLASS__ Range_Limitation
-static void Range_Limitation_CHECKING_OUT_OF_RANGE(void *const s_, void *const p_)
-{
-#define THISSTATE__ CHECKING_OUT_OF_RANGE
-    INSTR_FUNC("sio.Range_Limitation.CHECKING_OUT_OF_RANGE") ;
-    struct Range_Limitation *const self = (struct Range_Limitation *)s_ ;
-    struct Range_Limitation_CHECKING_OUT_OF_RANGE_rcvd_evt {
-        sio_Point_Value pointValue ;
-    } const *const rcvd_evt = (struct Range_Limitation_CHECKING_OUT_OF_RANGE_rcvd_evt const *)p_ ;
-
-    ClassRefVar(Point_Threshold, pt) = self->R7_PT ;
-
-    bool outRange = pt->Direction == Rising ?
-            rcvd_evt->pointValue > pt->Limit :
-            rcvd_evt->pointValue <= pt->Limit ;
-    if (outRange) {
-        if (++self->Over_count >= pt->Over_limit) {
-            PYCCA_generateToSelf(Out_of_range) ;
-        }
-    } else {
-        self->Over_count = 0 ;
+    sc->R6 = cg ;
+
+    sc->Converter_available = false ;
+    cg->Waiting_for_converter = false ;
+
+    Msec now = (Msec)(mechNow() / 1000) ;
+    Msec wait = now - cg->Ready_at ;
+    cg->Wait_time += wait ;
+    if (wait > cg->Max_wait) {
+        cg->Max_wait = wait ;
     }
-#undef THISSTATE__
-}
-static void Range_Limitation_CHECKING_IN_RANGE(void *const s_, void *const p_)
-{
-#define THISSTATE__ CHECKING_IN_RANGE
-    INSTR_FUNC("sio.Range_Limitation.CHECKING_IN_RANGE") ;
-    struct Range_Limitation *const self = (struct Range_Limitation *)s_ ;
-    struct Range_Limitation_CHECKING_IN_RANGE_rcvd_evt {
-        sio_Point_Value pointValue ;
-    } const *const rcvd_evt = (struct Range_Limitation_CHECKING_IN_RANGE_rcvd_evt const *)p_ ;
-
-    ClassRefVar(Point_Threshold, pt) = self->R7_PT ;
-
-    bool inRange = pt->Direction == Rising ?
-            rcvd_evt->pointValue <= pt->Limit :
-            rcvd_evt->pointValue > pt->Limit ;
-    if (inRange) {
-        if (++self->Under_count >= pt->Under_limit) {
-            PYCCA_generateToSelf(In_range) ;
-        }
-    } else {
-        self->Under_count = 0 ;
+    if (sc->Conversion_count++ != 0) {
+        sc->Idle_time += now - sc->Changed_at ;
     }
+    sc->Changed_at = now ;
+
+    PYCCA_generate(Converter_assigned, Signal_Converter, sc, self) ;
 #undef THISSTATE__
 }
 #undef THISCLASS__
@@ -1411,7 +1867,6 @@ static void Range_Limitation_IN_RANGE(void *const s_, void *const p_)
         IO_Point, R1) ;
     ExternalOp(NOTIFY_In_range)(PYCCA_idOfRef(IO_Point, iop),
             PYCCA_idOfRef(Point_Threshold, self->R7_PT)) ;
-    self->Over_count = 0 ;
 #undef THISSTATE__
 }
 static void Range_Limitation_OUT_OF_RANGE(void *const s_, void *const p_)
@@ -1427,7 +1882,77 @@ static void Range_Limitation_OUT_OF_RANGE(void *const s_, void *const p_)
         IO_Point, R1) ;
     ExternalOp(NOTIFY_Out_of_range)(PYCCA_idOfRef(IO_Point, iop),
             PYCCA_idOfRef(Point_Threshold, self->R7_PT)) ;
-    self->Under_count = 0 ;
+#undef THISSTATE__
+}
+#undef THISCLASS__
+#define THISCLASS__ Sampling_Scheduler
+static void Sampling_Scheduler_IDLE(void *const s_, void *const p_)
+{
+#define THISSTATE__ IDLE
+    INSTR_FUNC("sio.Sampling_Scheduler.IDLE") ;
+
+#undef THISSTATE__
+}
+static void Sampling_Scheduler_WAITING(void *const s_, void *const p_)
+{
+#define THISSTATE__ WAITING
+    INSTR_FUNC("sio.Sampling_Scheduler.WAITING") ;
+    struct Sampling_Scheduler *const self = (struct Sampling_Scheduler *)s_ ;
+
+    PYCCA_cancelDelayedToSelf(Tick) ;
+
+    Msec now = (Msec)(mechNow() / 1000) ;
+    bool scheduled = false ;
+    int32_t delay = 0 ;
+    ClassRefVar(Conversion_Group, cg) ;
+    PYCCA_forAllInst(cg, Conversion_Group) {
+        if (cg->Scheduled) {
+            int32_t until = (int32_t)(cg->Next_sample - now) ;
+            if (!scheduled || until < delay) {
+                delay = until ;
+            }
+            scheduled = true ;
+        }
+    }
+
+    if (scheduled) {
+        PYCCA_generateDelayedToSelf(Tick, delay > 0 ? delay : 0) ;
+    } else {
+        PYCCA_generateToSelf(Stop) ;
+    }
+#undef THISSTATE__
+}
+static void Sampling_Scheduler_SAMPLING(void *const s_, void *const p_)
+{
+#define THISSTATE__ SAMPLING
+    INSTR_FUNC("sio.Sampling_Scheduler.SAMPLING") ;
+    struct Sampling_Scheduler *const self = (struct Sampling_Scheduler *)s_ ;
+
+    Msec now = (Msec)(mechNow() / 1000) ;
+    ClassRefVar(Conversion_Group, cg) ;
+    PYCCA_forAllInst(cg, Conversion_Group) {
+        int32_t late = (int32_t)(now - cg->Next_sample) ;
+        if (!cg->Scheduled || late < -SAMPLING_EARLY_TOLERANCE) {
+            continue ;
+        }
+        if (late > 0 && (Msec)late > cg->Max_jitter) {
+            cg->Max_jitter = late ;
+        }
+        if (cg->Sample_pending) {
+            cg->Overrun_count++ ;
+        } else {
+            cg->Sample_pending = true ;
+            cg->Sample_count++ ;
+            PYCCA_generate(Sample, Conversion_Group, cg, cg) ;
+        }
+
+        cg->Next_sample += cg->Period ;
+        while ((int32_t)(now - cg->Next_sample) >= 0) {
+            cg->Next_sample += cg->Period ;
+            cg->Overrun_count++ ;
+        }
+    }
+    PYCCA_generateToSelf(Continue) ;
 #undef THISSTATE__
 }
 #undef THISCLASS__
@@ -1441,19 +1966,42 @@ static void Signal_Converter_CONVERSION_COMPLETE(void *const s_, void *const p_)
     ClassRefVar(Conversion_Group, cg) ;
     cg = self->R6 ;
     assert(cg != NULL) ;
+
+    Scaling_Vector sv ;
+    unsigned count = 0 ;
     ClassRefConstSetVar(Continuous_Input_Point, cipset) ;
     PYCCA_forAllRelated(cipset, cg, R4) {
-        ClassRefVar(Continuous_Input_Point, cip) = *cipset ;
-        ClassRefVar(IO_Point, iop) = PYCCA_unionSupertype(
-            PYCCA_unionSupertype(cip, Continuous_Point, R2), IO_Point, R1) ;
-        sio_Point_Value value = ExternalOp(DEVICE_Read_converted_value)(
+        ClassRefVar(Continuous_Point, cpt) = PYCCA_unionSupertype(*cipset,
+                Continuous_Point, R2) ;
+        ClassRefVar(IO_Point, iop) = PYCCA_unionSupertype(cpt, IO_Point, R1) ;
+        ClassRefVar(Point_Scaling, ps) = cpt->R3 ;
+        assert(ps != NULL) ;
+        assert(count < COUNTOF(sv.values)) ;
+
+        sv.values[count] = ExternalOp(DEVICE_Read_converted_value)(
                 PYCCA_idOfSelf, PYCCA_idOfRef(IO_Point, iop)) ;
-        InstOp(Continuous_Input_Point, updateValue)(cip, value) ;
+        sv.multiplier[count] = ps->Multiplier ;
+        sv.divisor[count] = ps->Divisor ;
+        sv.intercept[count] = ps->Intercept ;
+        sv.mask[count] = ps->Mask ;
+        count++ ;
+    }
+
+    ClassOp(Point_Scaling, scaleValuesIn)(&sv, count) ;
+
+    count = 0 ;
+    PYCCA_forAllRelated(cipset, cg, R4) {
+        InstOp(Continuous_Input_Point, updateValue)(*cipset,
+                sv.values[count++]) ;
     }
     PYCCA_generate(Conversion_done, Conversion_Group, cg, self) ;
 
     self->R6 = NULL ;
 
+    Msec now = (Msec)(mechNow() / 1000) ;
+    self->Busy_time += now - self->Changed_at ;
+    self->Changed_at = now ;
+
     self->Converter_available = true ;
     ClassRefVar(R6_Assigner, r6asgn) = self->assigner ;
     PYCCA_generate(Converter_ready, R6_Assigner, r6asgn, self) ;
@@ -1479,7 +2027,7 @@ static void Signalling_Point_OFF(void *const s_, void *const p_)
     INSTR_FUNC("sio.Signalling_Point.OFF") ;
     struct Signalling_Point *const self = (struct Signalling_Point *)s_ ;
 
-    PYCCA_cancelDelayedToSelf(Confirm) ;
+    ThisClassInstOp(cancelDebounce)(self) ;
     ExternalOp(DEVICE_Disable_signal)(
             PYCCA_idOfRef(IO_Point, PYCCA_unionSupertype(self, IO_Point, R1))) ;
 #undef THISSTATE__
@@ -1502,7 +2050,7 @@ static void Signalling_Point_DEBOUNCING(void *const s_, void *const p_)
     INSTR_FUNC("sio.Signalling_Point.DEBOUNCING") ;
     struct Signalling_Point *const self = (struct Signalling_Point *)s_ ;
 
-    PYCCA_generateDelayedToSelf(Confirm, self->Debounce_time) ;
+    ThisClassInstOp(startDebounce)(self) ;
 #undef THISSTATE__
 }
 static void Signalling_Point_CONFIRMING(void *const s_, void *const p_)
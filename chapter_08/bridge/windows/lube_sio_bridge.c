@@ -47,10 +47,28 @@
 #define COUNTOF(a)  (sizeof(a) / sizeof(a[0]))
 #endif /* COUNTOF */
 
+typedef enum {
+    BridgeUnmapped = 0,         // <1>
+    BridgeInjector,
+    BridgeMachinery,
+    BridgeReservoir,
+} BridgeTargetClass ;
+
 typedef struct {
-    InstId_t fromInst ;
+    BridgeTargetClass targetClass ;
     InstId_t toInst ;
-} BridgeIDMap ;
+} BridgePointMap ;
+typedef struct {
+    void (*notify)(InstId_t, EventCode) ;   // <1>
+    EventCode event ;
+} BridgeThresholdAction ;
+
+typedef struct {
+    BridgeThresholdAction inRange ;
+    BridgeThresholdAction outOfRange ;
+} BridgeThresholdMap ;
+static void signalInjector(InstId_t injectorId, EventCode event) ;
+static void injectorMaxPressure(InstId_t injectorId, EventCode event) ;
 static sio_Point_ID const injToPointMap[LUBE_INJECTOR_INST_COUNT] = {
     [LUBE_INJECTOR_IN1_INST_ID] = SIO_IO_POINT_IOP1_INST_ID,
     [LUBE_INJECTOR_IN2_INST_ID] = SIO_IO_POINT_IOP2_INST_ID,
@@ -61,56 +79,77 @@ static sio_Point_ID const presToConvGrpMap[LUBE_INJECTOR_INST_COUNT] = {
     [LUBE_INJECTOR_IN2_INST_ID] = SIO_CONVERSION_GROUP_INJ2_CG_INST_ID,
     [LUBE_INJECTOR_IN3_INST_ID] = SIO_CONVERSION_GROUP_INJ3_CG_INST_ID,
 } ;
-static BridgeIDMap const presToInjMap[LUBE_INJECTOR_INST_COUNT] = {
-    {
-        .fromInst = SIO_IO_POINT_IOP1_INST_ID,
+static BridgePointMap const pointToLubeInstMap[SIO_IO_POINT_INST_COUNT] = {
+    [SIO_IO_POINT_IOP1_INST_ID] = {
+        .targetClass = BridgeInjector,
         .toInst = LUBE_INJECTOR_IN1_INST_ID,
     },
-    {
-        .fromInst = SIO_IO_POINT_IOP2_INST_ID,
+    [SIO_IO_POINT_IOP2_INST_ID] = {
+        .targetClass = BridgeInjector,
         .toInst = LUBE_INJECTOR_IN2_INST_ID,
     },
-    {
-        .fromInst = SIO_IO_POINT_IOP3_INST_ID,
+    [SIO_IO_POINT_IOP3_INST_ID] = {
+        .targetClass = BridgeInjector,
         .toInst = LUBE_INJECTOR_IN3_INST_ID,
     },
-} ;
-static BridgeIDMap const
-    sigPtToLubeInstMap[LUBE_MACHINERY_INST_COUNT + LUBE_RESERVOIR_INST_COUNT] = {
-    {
-        .fromInst = SIO_IO_POINT_IOP7_INST_ID,
+    [SIO_IO_POINT_IOP7_INST_ID] = {
+        .targetClass = BridgeMachinery,
         .toInst = LUBE_MACHINERY_M1_INST_ID,
     },
-    {
-        .fromInst = SIO_IO_POINT_IOP8_INST_ID,
+    [SIO_IO_POINT_IOP8_INST_ID] = {
+        .targetClass = BridgeMachinery,
         .toInst = LUBE_MACHINERY_M2_INST_ID,
     },
-    {
-        .fromInst = SIO_IO_POINT_IOP9_INST_ID,
+    [SIO_IO_POINT_IOP9_INST_ID] = {
+        .targetClass = BridgeMachinery,
         .toInst = LUBE_MACHINERY_M3_INST_ID,
     },
-    {
-        .fromInst = SIO_IO_POINT_IOP10_INST_ID,
+    [SIO_IO_POINT_IOP10_INST_ID] = {
+        .targetClass = BridgeReservoir,
         .toInst = LUBE_RESERVOIR_RES1_INST_ID,
     },
-    {
-        .fromInst = SIO_IO_POINT_IOP11_INST_ID,
+    [SIO_IO_POINT_IOP11_INST_ID] = {
+        .targetClass = BridgeReservoir,
         .toInst = LUBE_RESERVOIR_RES2_INST_ID,
     },
 } ;
-static BridgeIDMap const *
+static BridgeThresholdMap const thresholdMap[SIO_POINT_THRESHOLD_INST_COUNT] = {
+    [SIO_POINT_THRESHOLD_IX77B_ABOVE_INJ_INST_ID] = {
+        .inRange = {signalInjector,
+                LUBE_INJECTOR_BELOW_INJECT_PRESSURE_EVENT_ID},
+        .outOfRange = {signalInjector,
+                LUBE_INJECTOR_ABOVE_INJECT_PRESSURE_EVENT_ID},
+    },
+    [SIO_POINT_THRESHOLD_IHN4_ABOVE_INJ_INST_ID] = {
+        .inRange = {signalInjector,
+                LUBE_INJECTOR_BELOW_INJECT_PRESSURE_EVENT_ID},
+        .outOfRange = {signalInjector,
+                LUBE_INJECTOR_ABOVE_INJECT_PRESSURE_EVENT_ID},
+    },
+    [SIO_POINT_THRESHOLD_IX77B_ABOVE_DISP_INST_ID] = {
+        .outOfRange = {signalInjector,
+                LUBE_INJECTOR_ABOVE_DISSIPATION_PRESSURE_EVENT_ID},
+    },
+    [SIO_POINT_THRESHOLD_IHN4_ABOVE_DISP_INST_ID] = {
+        .outOfRange = {signalInjector,
+                LUBE_INJECTOR_ABOVE_DISSIPATION_PRESSURE_EVENT_ID},
+    },
+    [SIO_POINT_THRESHOLD_IX77B_MAX_PRES_INST_ID] = {
+        .outOfRange = {injectorMaxPressure, 0},
+    },
+    [SIO_POINT_THRESHOLD_IHN4_MAX_PRES_INST_ID] = {
+        .outOfRange = {injectorMaxPressure, 0},
+    },
+} ;
+static BridgePointMap const *
 mapIOPoint(
-    BridgeIDMap const *mapping,
-    int numMappings,
-    InstId_t from)
+    sio_Point_ID point,
+    BridgeTargetClass targetClass)
 {
-    for ( ; numMappings > 0 ; numMappings--, mapping++) {
-        if (mapping->fromInst == from) {
-            return mapping ;
-        }
-    }
+    assert(point < COUNTOF(pointToLubeInstMap)) ;
 
-    return NULL ;
+    BridgePointMap const *mapping = pointToLubeInstMap + point ;
+    return mapping->targetClass == targetClass ? mapping : NULL ;
 }
 static void
 signalInjector(
@@ -129,6 +168,34 @@ signalInjector(
     assert(pcode == 0) ;
     (void)pcode ;
 }
+static void
+injectorMaxPressure(
+    InstId_t injectorId,
+    EventCode event)
+{
+    assert(injectorId < LUBE_INJECTOR_INST_COUNT) ;
+    (void)event ;
+
+    lube_Injector_max_pressure(injectorId) ;
+}
+static void
+notifyThreshold(
+    sio_Point_ID point,
+    BridgeThresholdAction const *action)
+{
+    if (action->notify == NULL) {
+        return ;                // <1>
+    }
+
+    BridgePointMap const *pointMap = mapIOPoint(point, BridgeInjector) ;
+
+    assert(pointMap != NULL) ;
+    if (pointMap == NULL) {
+        return ;
+    }
+
+    action->notify(pointMap->toInst, action->event) ;
+}
 
 static void
 controlInjector(
@@ -212,7 +279,7 @@ eop_sio_NOTIFY_New_point_value(
 
     assert(point < SIO_IO_POINT_INST_COUNT) ;
 
-    BridgeIDMap const * pointMap = mapIOPoint(presToInjMap, COUNTOF(presToInjMap), point) ;
+    BridgePointMap const *pointMap = mapIOPoint(point, BridgeInjector) ;
 
     assert(pointMap != NULL) ;
     if (pointMap == NULL) {
@@ -242,25 +309,7 @@ eop_sio_NOTIFY_In_range(
     assert(point < SIO_IO_POINT_INST_COUNT) ;
     assert(threshold < SIO_POINT_THRESHOLD_INST_COUNT) ;
 
-    BridgeIDMap const *pointMap = mapIOPoint(presToInjMap, COUNTOF(presToInjMap), point) ;
-
-    assert(pointMap != NULL) ;
-    if (pointMap == NULL) {
-        return ;
-    }
-
-    switch (threshold) {
-    case SIO_POINT_THRESHOLD_IX77B_ABOVE_INJ_INST_ID:// fall through
-    case SIO_POINT_THRESHOLD_IHN4_ABOVE_INJ_INST_ID:
-        signalInjector(pointMap->toInst,
-            LUBE_INJECTOR_BELOW_INJECT_PRESSURE_EVENT_ID) ;
-        break ;
-
-    /*
-     * N.B. no default case.
-     * Unexpected Range Limitation instances are silently ignored.
-     */
-    }
+    notifyThreshold(point, &thresholdMap[threshold].inRange) ;
 }
 void
 eop_sio_NOTIFY_Out_of_range(
@@ -275,36 +324,7 @@ eop_sio_NOTIFY_Out_of_range(
     assert(point < SIO_IO_POINT_INST_COUNT) ;
     assert(threshold < SIO_POINT_THRESHOLD_INST_COUNT) ;
 
-    BridgeIDMap const *pointMap = mapIOPoint(presToInjMap, COUNTOF(presToInjMap), point) ;
-
-    assert(pointMap != NULL) ;
-    if (pointMap == NULL) {
-        return ;
-    }
-
-    switch (threshold) {
-    case SIO_POINT_THRESHOLD_IX77B_ABOVE_INJ_INST_ID:// fall through
-    case SIO_POINT_THRESHOLD_IHN4_ABOVE_INJ_INST_ID:
-        signalInjector(pointMap->toInst,
-                LUBE_INJECTOR_ABOVE_INJECT_PRESSURE_EVENT_ID) ;
-        break ;
-
-    case SIO_POINT_THRESHOLD_IX77B_ABOVE_DISP_INST_ID:// fall through
-    case SIO_POINT_THRESHOLD_IHN4_ABOVE_DISP_INST_ID:
-        signalInjector(pointMap->toInst,
-                LUBE_INJECTOR_ABOVE_DISSIPATION_PRESSURE_EVENT_ID) ;
-        break ;
-
-    case SIO_POINT_THRESHOLD_IX77B_MAX_PRES_INST_ID:// fall through
-    case SIO_POINT_THRESHOLD_IHN4_MAX_PRES_INST_ID:
-        lube_Injector_max_pressure(pointMap->toInst) ;      // <1>
-        break ;
-
-    /*
-     * N.B. no default case.
-     * Unexpected Range Limitation instances are silently ignored.
-     */
-    }
+    notifyThreshold(point, &thresholdMap[threshold].outOfRange) ;
 }
 void
 eop_sio_NOTIFY_Signal_point(
@@ -318,26 +338,17 @@ eop_sio_NOTIFY_Signal_point(
 
     assert(point < SIO_IO_POINT_INST_COUNT) ;
 
-    BridgeIDMap const * pointMap = mapIOPoint(sigPtToLubeInstMap,
-            COUNTOF(sigPtToLubeInstMap), point) ;
+    BridgePointMap const *pointMap = pointToLubeInstMap + point ;
 
-    assert(pointMap != NULL) ;
-    if (pointMap == NULL) {
-        return ;
-    }
-
-    switch (point) {
-    case SIO_IO_POINT_IOP7_INST_ID: // fall through
-    case SIO_IO_POINT_IOP8_INST_ID: // fall through
-    case SIO_IO_POINT_IOP9_INST_ID: {
+    switch (pointMap->targetClass) {
+    case BridgeMachinery: {
         void (*lubeOp)(InstId_t) = isActive ?
                 lube_Lock_Machinery : lube_Unlock_Machinery ;
         lubeOp(pointMap->toInst) ;
     }
         break ;
 
-    case SIO_IO_POINT_IOP10_INST_ID: // fall through
-    case SIO_IO_POINT_IOP11_INST_ID: {
+    case BridgeReservoir: {
         EventCode levelEvent = isActive ?
                 LUBE_RESERVOIR_NORMAL_LUBE_LEVEL_EVENT_ID :
                 LUBE_RESERVOIR_LOW_LUBE_LEVEL_EVENT_ID ;
@@ -351,8 +362,9 @@ eop_sio_NOTIFY_Signal_point(
         (void)pcode ;
     }
         break ;
-    /*
-     * N.B. no default case.
-     */
+
+    default:
+        assert(pointMap->targetClass != BridgeUnmapped) ;
+        break ;
     }
 }
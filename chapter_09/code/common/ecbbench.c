@@ -0,0 +1,247 @@
+/*
+ *++
+ * PROJECT:
+ *  Models to Code Book
+ *
+ * MODULE:
+ *  ecbbench.c -- event dispatch benchmark for the ECB layouts
+ *
+ * ABSTRACT:
+ *  Passes tokens around a ring of instances of a one state class, each
+ *  dispatch posting an event to an instance further around the ring, and
+ *  reports the time and, where the processor counters can be read, the
+ *  cache misses per dispatched event. Many tokens are in flight at once
+ *  so that the ECBs of the queue span much of the pool. The program is
+ *  built once with the default ECB layout and once with MECH_ECB_COMPACT
+ *  so the two may be compared. It exits once the events are dispatched.
+ *
+ *--
+ */
+
+/*
+ * INCLUDE FILES
+ */
+#define _POSIX_C_SOURCE 200112L
+#ifdef __linux__
+#   define _DEFAULT_SOURCE
+#endif /* __linux__ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "mechs.h"
+#ifdef __linux__
+#   include <unistd.h>
+#   include <sys/ioctl.h>
+#   include <sys/syscall.h>
+#   include <linux/perf_event.h>
+#endif /* __linux__ */
+
+/*
+ * MACRO DEFINITIONS
+ */
+#ifndef ECBBENCH_RING
+#   define ECBBENCH_RING        4096
+#endif /* ECBBENCH_RING */
+
+#ifndef ECBBENCH_TOKENS
+#   define ECBBENCH_TOKENS      8192
+#endif /* ECBBENCH_TOKENS */
+
+#ifndef ECBBENCH_EVENTS
+#   define ECBBENCH_EVENTS      10000000UL
+#endif /* ECBBENCH_EVENTS */
+
+/*
+ * Each token moves this many instances around the ring at each step. It
+ * is prime so that successive targets are scattered through the storage.
+ */
+#define ECBBENCH_STRIDE         97
+
+/*
+ * Dispatches before timing starts, so that every ECB has been used.
+ */
+#define ECBBENCH_WARMUP         (ECBBENCH_TOKENS * 4UL)
+
+#ifdef MECH_ECB_COMPACT
+#   define ECBBENCH_LAYOUT      "compact"
+#else
+#   define ECBBENCH_LAYOUT      "default"
+#endif /* MECH_ECB_COMPACT */
+
+/*
+ * TYPE DEFINITIONS
+ */
+struct ringnode {
+    struct mechinstance common_ ;
+    unsigned long passes ;
+} ;
+
+/*
+ * FORWARD FUNCTION DECLARATIONS
+ */
+static void ringPass(void *const, void *const) ;
+
+/*
+ * STATIC DATA DEFINITIONS
+ */
+static struct ringnode ringStorage[ECBBENCH_RING] ;
+
+static struct installocblock ringAllocBlock = {
+    .storageStart = ringStorage,
+    .storageFinish = ringStorage + ECBBENCH_RING,
+    .storageLast = ringStorage + ECBBENCH_RING - 1,
+    .allocCounter = 1,
+    .instanceSize = sizeof(struct ringnode),
+} ;
+
+/*
+ * One state with one event that transitions back to it.
+ */
+static StateCode const ringTransitions[] = { 0 } ;
+static PtrActionFunction const ringActions[] = { ringPass } ;
+
+static struct objectdispatchblock const ringDispatch = {
+    .stateCount = 1,
+    .eventCount = 1,
+    .transitionTable = ringTransitions,
+    .actionTable = ringActions,
+} ;
+
+static struct mechclass const ringClass = {
+    .iab = &ringAllocBlock,
+    .odb = &ringDispatch,
+} ;
+
+static unsigned long dispatched ;
+static double startTime ;
+static int missCounter = -1 ;
+
+/*
+ * STATIC INLINE FUNCTION DEFINITIONS
+ */
+static inline double
+benchSeconds(void)
+{
+    struct timespec now ;
+    clock_gettime(CLOCK_MONOTONIC, &now) ;
+    return now.tv_sec + now.tv_nsec / 1e9 ;
+}
+
+/*
+ * STATIC FUNCTION DEFINITIONS
+ */
+
+/*
+ * Open a counter of the cache misses of this process. Where the counter
+ * is not available, e.g. on a virtual machine that does not pass the
+ * processor counters through, only the time is reported.
+ */
+static void
+missCounterStart(void)
+{
+#ifdef __linux__
+    struct perf_event_attr attr ;
+    memset(&attr, 0, sizeof(attr)) ;
+    attr.size = sizeof(attr) ;
+    attr.type = PERF_TYPE_HARDWARE ;
+    attr.config = PERF_COUNT_HW_CACHE_MISSES ;
+    attr.disabled = 1 ;
+    attr.exclude_kernel = 1 ;
+    attr.exclude_hv = 1 ;
+
+    missCounter = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0) ;
+    if (missCounter != -1) {
+        ioctl(missCounter, PERF_EVENT_IOC_RESET, 0) ;
+        ioctl(missCounter, PERF_EVENT_IOC_ENABLE, 0) ;
+    }
+#endif /* __linux__ */
+}
+
+static bool
+missCounterStop(
+    unsigned long long *misses)
+{
+#ifdef __linux__
+    if (missCounter != -1) {
+        ioctl(missCounter, PERF_EVENT_IOC_DISABLE, 0) ;
+        bool ok = read(missCounter, misses, sizeof(*misses)) ==
+                sizeof(*misses) ;
+        close(missCounter) ;
+        return ok ;
+    }
+#endif /* __linux__ */
+    return false ;
+}
+
+static void
+benchReport(void)
+{
+    double elapsed = benchSeconds() - startTime ;
+    unsigned long long misses ;
+    bool counted = missCounterStop(&misses) ;
+
+    printf("ecbbench: %s layout, %u byte ECBs, %lu events in %.3f s, "
+            "%.1f ns/event\n", ECBBENCH_LAYOUT,
+            (unsigned)sizeof(struct mechecb), ECBBENCH_EVENTS, elapsed,
+            elapsed * 1e9 / ECBBENCH_EVENTS) ;
+    if (counted) {
+        printf("ecbbench: %llu cache misses, %.3f per event\n", misses,
+                (double)misses / ECBBENCH_EVENTS) ;
+    } else {
+        printf("ecbbench: cache misses not available\n") ;
+    }
+}
+
+/*
+ * The action of the ring class. The token is passed on to the instance
+ * ECBBENCH_STRIDE further around the ring.
+ */
+static void
+ringPass(
+    void *const s,
+    void *const p)
+{
+    struct ringnode *const self = s ;
+    ++self->passes ;
+
+    ++dispatched ;
+    if (dispatched == ECBBENCH_WARMUP) {
+        missCounterStart() ;
+        startTime = benchSeconds() ;
+    } else if (dispatched == ECBBENCH_WARMUP + ECBBENCH_EVENTS) {
+        benchReport() ;
+        exit(EXIT_SUCCESS) ;
+    }
+
+    struct ringnode *next = ringStorage +
+            (self - ringStorage + ECBBENCH_STRIDE) % ECBBENCH_RING ;
+    mechEventPost(mechEventNew(0, &next->common_, &self->common_)) ;
+}
+
+/*
+ * EXTERNAL FUNCTION DEFINITIONS
+ */
+void
+sysDeviceInit(void)
+{
+}
+
+void
+sysDomainInit(void)
+{
+    for (struct ringnode *node = ringStorage ;
+            node < ringStorage + ECBBENCH_RING ; ++node) {
+        node->common_.alloc = 1 ;
+        node->common_.currentState = 0 ;
+        node->common_.instClass = &ringClass ;
+    }
+    /*
+     * The tokens start spread evenly around the ring.
+     */
+    for (unsigned t = 0 ; t < ECBBENCH_TOKENS ; ++t) {
+        struct ringnode *node = ringStorage +
+                (unsigned long)t * ECBBENCH_RING / ECBBENCH_TOKENS ;
+        mechEventPost(mechEventNew(0, &node->common_, NULL)) ;
+    }
+}
@@ -67,7 +67,6 @@
 #include <assert.h>
 
 #include <time.h>
-#include <sys/time.h>
 
 #include "harness.h"
 #include "pycca_portal.h"
@@ -115,7 +114,9 @@ enum drvResultKey {
     drv_Attr,
     drv_Value,
     drv_Event,
-    drv_Delay
+    drv_Delay,
+    drv_Width,
+    drv_Length
 } ;
 
 enum drvCodeValue {
@@ -126,6 +127,17 @@ enum drvCodeValue {
 typedef void (*CategoryCmd)(dportal_t const *portal, int argc,
         char const **argv) ;
 
+/*
+ * A growable buffer used to accumulate responses that are too large to fit
+ * into a single result record. Such responses are sent following the
+ * record, with the record giving the "length" of the data.
+ */
+struct drvBlock {
+    char *data ;
+    size_t len ;
+    size_t cap ;
+} ;
+
 /*
  * EXTERNAL DATA DEFINITIONS
  */
@@ -145,13 +157,20 @@ static void drv_connection(int closure, int sock) ;
 static void drv_input(int closure, void *buf, size_t len) ;
 static void drv_output(enum drvResultKey key, char const *value, ...) ;
 static char const *drv_format(char const *fmt, ...) ;
+static bool drv_block_printf(struct drvBlock *blk, char const *fmt, ...) ;
+static char const *drv_quote_fmt(char const *value) ;
 
 static void stub_connection(int closure, int sock) ;
 static void stub_input(int closure, void *buf, size_t len) ;
 static void traceCallback(MechTraceInfo traceInfo) ;
 
+static void columnsCmd(dportal_t const *portal, int argc,
+        char const **argv) ;
 static void dopCmd(dportal_t const *portal, int argc, char const **argv) ;
+static void dumpCmd(dportal_t const *portal, int argc, char const **argv) ;
 static void dataCmd(dportal_t const *portal, int argc, char const **argv) ;
+static void selectCmd(dportal_t const *portal, int argc, char const **argv) ;
+static void statsCmd(dportal_t const *portal, int argc, char const **argv) ;
 static void eventCmd(dportal_t const *portal, int argc, char const **argv) ;
 static void polyeventCmd(dportal_t const *portal, int argc, char const **argv) ;
 static void delayEventCmd(dportal_t const *portal, int argc,
@@ -176,6 +195,8 @@ static event_map_t const *find_event_map(class_map_t const *class_map,
 static polyevent_map_t const *find_polyevent_map(class_map_t const *class_map,
         char const *name) ;
 
+static char const *parse_predicate(class_map_t const *cmap,
+        char const *const *terms, int nterms, struct pycca_predicate *pred) ;
 static int wordparse(char *line, char *const end, char const **argv,
         int *pargc) ;
 
@@ -198,12 +219,16 @@ static struct categoryMap {
     char const *name ;
     CategoryCmd cmd ;
 } categories[] = {
+    {.name = "columns",     .cmd = columnsCmd},
     {.name = "data",        .cmd = dataCmd},
     {.name = "delay",       .cmd = delayEventCmd},
     {.name = "delaypoly",   .cmd = delayPolyEventCmd},
     {.name = "dop",         .cmd = dopCmd},
+    {.name = "dump",        .cmd = dumpCmd},
     {.name = "event",       .cmd = eventCmd},
     {.name = "polyevent",   .cmd = polyeventCmd},
+    {.name = "select",      .cmd = selectCmd},
+    {.name = "stats",       .cmd = statsCmd},
 } ;
 
 /*
@@ -268,18 +293,13 @@ harness_stub_vprintf(
     /*
      * Put a timestamp on at the beginning.
      */
-    struct timeval tv ;
-    gettimeofday(&tv, NULL) ;
+    MechTime now = mechNowEpoch() ;
 
     char *place = buf ;
     int buflen = sizeof(buf) - 1 ; // allow for closing brace
-    int nchars = snprintf(place, buflen,
-    #ifdef __APPLE_CC__
-            "%s {time %ld.%d ",
-    #else
-            "%s {time %ld.%ld ",
-    #endif /*  __APPLE_CC__ */
-            type, tv.tv_sec, tv.tv_usec / 1000) ;
+    int nchars = snprintf(place, buflen, "%s {time %lu.%03lu ", type,
+            (unsigned long)(now / 1000000),
+            (unsigned long)(now % 1000000 / 1000)) ;
     if (nchars >= 0 && nchars < buflen) {
         place += nchars ;
         buflen -= nchars ;
@@ -332,20 +352,26 @@ drv_connection(
  * When commands are received they are of the form:
  *      <category> <domain> ....
  * where <category> is one of:
+ *      columns
  *      dop
+ *      dump
  *      data
  *      event
  *      polyevent
  *      delayed
  *      delayedpoly
+ *      select
  * and <domain> is the name of a domain.
  *
+ * columns <domain> <class> <attr1> ?<attr2> ...?
  * dop <domain> <opname> ?<arg1> <arg2> ...?
+ * dump <domain> <class>
  * data <domain> <class> <inst> <attr> ?<value>?
  * event <domain> <class> <inst> <event> ?<param1> <param2> ...?
  * polyevent <domain> <class> <inst> <event> ?<param1> <param2> ...?
  * delay <domain> <class> <inst> <delay> <event> ?<param1> <param2> ...?
  * delaypoly <domain> <class> <inst> <delay> <event> ?<param1> <param2> ...?
+ * select <domain> <class> ?<expression>?
  *
  * So here we divide the processing up into functions that are
  * associated with each category of request.
@@ -487,6 +513,8 @@ drv_output(
         "value",        // drv_Value
         "event",        // drv_Event
         "delay",        // drv_Delay
+        "width",        // drv_Width
+        "length",       // drv_Length
     } ;
 
     static char const *const fmts[] = {
@@ -550,6 +578,51 @@ drv_format(
     return buf ;
 }
 
+static bool
+drv_block_printf(
+    struct drvBlock *blk,
+    char const *fmt,
+    ...)
+{
+    for (;;) {
+        size_t avail = blk->cap - blk->len ;
+        va_list ap ;
+        va_start(ap, fmt) ;
+        int nchars = vsnprintf(blk->data + blk->len, avail, fmt, ap) ;
+        va_end(ap) ;
+        if (nchars < 0) {
+            return false ;
+        } else if (nchars < avail) {
+            blk->len += nchars ;
+            return true ;
+        }
+        /*
+         * Didn't fit. Grow the buffer and try again.
+         */
+        size_t newCap = blk->cap == 0 ? BUFSIZ : blk->cap * 2 ;
+        while (newCap - blk->len <= nchars) {
+            newCap *= 2 ;
+        }
+        char *newData = realloc(blk->data, newCap) ;
+        if (newData == NULL) {
+            return false ;
+        }
+        blk->data = newData ;
+        blk->cap = newCap ;
+    }
+}
+
+/*
+ * Values that contain spaces or are empty are quoted in the same manner
+ * as is done by "drv_output".
+ */
+static char const *
+drv_quote_fmt(
+    char const *value)
+{
+    return strchr(value, ' ') == NULL && strlen(value) != 0 ? "%s" : "{%s}" ;
+}
+
 static void
 stub_connection(
     int closure,
@@ -631,9 +704,6 @@ traceCallback(
         return ;
     }
 
-    struct timeval tv ;
-    gettimeofday(&tv, NULL) ;
-
     switch (traceInfo->eventType) {
     case NormalEvent:
         harness_stub_printf(traceLabel, 
@@ -831,6 +901,460 @@ dataCmd(
     }
 }
 
+/*
+ * columns <domain> <class> <attr1> ?<attr2> ...?
+ *
+ * Gather the values of the given attributes across all the allocated
+ * instances of the class. The response record is followed by "length" bytes
+ * of binary data. The data is a set of columns, each holding one value per
+ * gathered instance in native byte order. The first column contains the
+ * instance ids (as unsigned short) and the remaining columns correspond, in
+ * order, to the requested attributes. The "width" key gives the number of
+ * bytes in each value of each column and the "result" key gives the number of
+ * instances gathered.
+ */
+static void
+columnsCmd(
+    dportal_t const *portal,
+    int argc,
+    char const **argv)
+{
+    if (argc < 4) {
+        drv_output(
+                drv_Code, codeStrings[code_Error],
+                drv_Result, drv_format(
+                    "too few arguments %d", argc),
+                drv_Category, argv[0],
+                drv_Domain, argv[1],
+                drv_None, NULL) ;
+        return ;
+    }
+
+    class_map_t const *cmap = find_class_map(portal, argv[2]) ;
+    if (cmap == NULL) {
+        drv_output(
+                drv_Code, codeStrings[code_Error],
+                drv_Result, "unknown class",
+                drv_Category, argv[0],
+                drv_Domain, argv[1],
+                drv_Class, argv[2],
+                drv_None, NULL) ;
+        return ;
+    }
+
+    struct pycca_column columns[MAX_CMD_ARGS] ;
+    unsigned ncols = argc - 3 ;
+    for (unsigned col = 0 ; col < ncols ; ++col) {
+        attr_map_t const *amap = find_attr_map(cmap, argv[col + 3]) ;
+        if (amap == NULL) {
+            drv_output(
+                drv_Code, codeStrings[code_Error],
+                drv_Result, "unknown attribute",
+                drv_Category, argv[0],
+                drv_Domain, argv[1],
+                drv_Class, argv[2],
+                drv_Attr, argv[col + 3],
+                drv_None, NULL) ;
+            return ;
+        }
+        columns[col].attr = amap->id ;
+    }
+    /*
+     * Size the columns for the worst case of every instance slot being
+     * allocated. All the columns are carved out of a single block that
+     * is sent as is.
+     */
+    struct pycca_domain_portal const *dportal = portal->dportal ;
+    unsigned numInsts = dportal->classes[cmap->id].numInsts ;
+    size_t rowSize = sizeof(InstId_t) ;
+    for (unsigned col = 0 ; col < ncols ; ++col) {
+        rowSize += dportal->classes[cmap->id].attrs[columns[col].attr].size ;
+    }
+    char *block = malloc(rowSize * numInsts + 1) ;
+    if (block == NULL) {
+        drv_output(
+                drv_Code, codeStrings[code_Error],
+                drv_Result, "out of memory",
+                drv_Category, argv[0],
+                drv_Domain, argv[1],
+                drv_Class, argv[2],
+                drv_None, NULL) ;
+        return ;
+    }
+    char *place = block + sizeof(InstId_t) * numInsts ;
+    for (unsigned col = 0 ; col < ncols ; ++col) {
+        columns[col].values = place ;
+        columns[col].capacity =
+                dportal->classes[cmap->id].attrs[columns[col].attr].size *
+                numInsts ;
+        place += columns[col].capacity ;
+    }
+
+    int count = pycca_read_columns(dportal, cmap->id, columns, ncols,
+            (InstId_t *)block) ;
+    if (count < 0) {
+        free(block) ;
+        drv_output(
+                drv_Code, codeStrings[code_Error],
+                drv_Result, drv_format("column read failed: %d", count),
+                drv_Category, argv[0],
+                drv_Domain, argv[1],
+                drv_Class, argv[2],
+                drv_None, NULL) ;
+        return ;
+    }
+    /*
+     * Pack the columns down so that they are contiguous for the number of
+     * instances actually gathered.
+     */
+    char attrNames[BUFSIZ] ;
+    char widths[BUFSIZ] ;
+    int nattr = 0 ;
+    int nwidth = snprintf(widths, sizeof(widths), "%zu", sizeof(InstId_t)) ;
+    place = block + sizeof(InstId_t) * count ;
+    for (unsigned col = 0 ; col < ncols ; ++col) {
+        size_t colSize = (size_t)columns[col].width * count ;
+        memmove(place, columns[col].values, colSize) ;
+        place += colSize ;
+        nattr += snprintf(attrNames + nattr, sizeof(attrNames) - nattr,
+                col == 0 ? "%s" : " %s", argv[col + 3]) ;
+        nwidth += snprintf(widths + nwidth, sizeof(widths) - nwidth, " %u",
+                columns[col].width) ;
+    }
+    size_t length = place - block ;
+
+    char countStr[32] ;
+    snprintf(countStr, sizeof(countStr), "%d", count) ;
+    char lengthStr[32] ;
+    snprintf(lengthStr, sizeof(lengthStr), "%zu", length) ;
+    drv_output(
+            drv_Code, codeStrings[code_Success],
+            drv_Result, countStr,
+            drv_Category, argv[0],
+            drv_Domain, argv[1],
+            drv_Class, argv[2],
+            drv_Attr, attrNames,
+            drv_Width, widths,
+            drv_Length, lengthStr,
+            drv_None, NULL) ;
+    mechOutputAll(drvDataSock, block, length) ;
+    free(block) ;
+}
+
+/*
+ * dump <domain> <class>
+ *
+ * Read every attribute and the current state of every allocated instance of
+ * the class. The response record is followed by "length" bytes of text, one
+ * line for each instance, of the form:
+ *
+ *      inst <id> state <state number> attrs {<attr> <value> ...}
+ *
+ * The state is empty for classes that do not have a state model.
+ */
+static void
+dumpCmd(
+    dportal_t const *portal,
+    int argc,
+    char const **argv)
+{
+    if (argc != 3) {
+        drv_output(
+                drv_Code, codeStrings[code_Error],
+                drv_Result, drv_format(
+                    "wrong number of arguments %d", argc),
+                drv_Category, argv[0],
+                drv_Domain, argv[1],
+                drv_None, NULL) ;
+        return ;
+    }
+
+    class_map_t const *cmap = find_class_map(portal, argv[2]) ;
+    if (cmap == NULL) {
+        drv_output(
+                drv_Code, codeStrings[code_Error],
+                drv_Result, "unknown class",
+                drv_Category, argv[0],
+                drv_Domain, argv[1],
+                drv_Class, argv[2],
+                drv_None, NULL) ;
+        return ;
+    }
+
+    struct pycca_domain_portal const *dportal = portal->dportal ;
+    unsigned numInsts = dportal->classes[cmap->id].numInsts ;
+    struct drvBlock blk = {
+        .data = NULL,
+        .len = 0,
+        .cap = 0,
+    } ;
+    bool ok = true ;
+    unsigned count = 0 ;
+    for (unsigned inst_id = 0 ; ok && inst_id < numInsts ; ++inst_id) {
+        StateCode state ;
+        int status = pycca_read_state(dportal, cmap->id, inst_id, &state) ;
+        if (status == PYCCA_PORTAL_UNALLOC) {
+            continue ;
+        }
+        ok = status == 0 ?
+            drv_block_printf(&blk, "inst %u state %u attrs {",
+                inst_id, state) :
+            drv_block_printf(&blk, "inst %u state {} attrs {", inst_id) ;
+
+        attr_map_t const *amap = cmap->attrs ;
+        for (unsigned attr = 0 ; ok && attr < cmap->attr_count ;
+                ++attr, ++amap) {
+            char const *value ;
+            if (!amap->attr_read(dportal, cmap->id, inst_id, amap->id,
+                    &value)) {
+                value = "" ;
+            }
+            ok = drv_block_printf(&blk, attr == 0 ? "%s " : " %s ",
+                    amap->name) &&
+                drv_block_printf(&blk, drv_quote_fmt(value), value) ;
+        }
+        ok = ok && drv_block_printf(&blk, "}\r\n") ;
+        ++count ;
+    }
+
+    if (ok) {
+        char countStr[32] ;
+        snprintf(countStr, sizeof(countStr), "%u", count) ;
+        char lengthStr[32] ;
+        snprintf(lengthStr, sizeof(lengthStr), "%zu", blk.len) ;
+        drv_output(
+                drv_Code, codeStrings[code_Success],
+                drv_Result, countStr,
+                drv_Category, argv[0],
+                drv_Domain, argv[1],
+                drv_Class, argv[2],
+                drv_Length, lengthStr,
+                drv_None, NULL) ;
+        mechOutputAll(drvDataSock, blk.data, blk.len) ;
+    } else {
+        drv_output(
+                drv_Code, codeStrings[code_Error],
+                drv_Result, "out of memory",
+                drv_Category, argv[0],
+                drv_Domain, argv[1],
+                drv_Class, argv[2],
+                drv_None, NULL) ;
+    }
+    free(blk.data) ;
+}
+
+/*
+ * select <domain> <class> ?<expression>?
+ *
+ * Find the allocated instances of the class whose attribute values satisfy
+ * the expression. The expression is a set of terms joined by "&&" where each
+ * term is one of:
+ *
+ *      <attr> <op> <literal>
+ *      <attr>
+ *      !<attr>
+ *
+ * and <op> is one of: == != < <= > >=. A bare attribute name is true if the
+ * attribute is non-zero and a negated one if it is zero. The tokens must be
+ * separated by whitespace and the expression may be given as one braced word.
+ * Since the harness does not know the type of an attribute, the literal
+ * determines how the attribute is interpreted:
+ *
+ *      25, -3, 0x1f    signed integer
+ *      25u             unsigned integer
+ *      2.5, 1e3        floating point (float or double attributes)
+ *      true, false     signed integer 1 or 0
+ *
+ * The response record "result" gives the number of matching instances and
+ * is followed by "length" bytes of text holding the instance ids separated
+ * by spaces and terminated by CR/NL.
+ */
+static void
+selectCmd(
+    dportal_t const *portal,
+    int argc,
+    char const **argv)
+{
+    if (argc < 3) {
+        drv_output(
+                drv_Code, codeStrings[code_Error],
+                drv_Result, drv_format(
+                    "too few arguments %d", argc),
+                drv_Category, argv[0],
+                drv_Domain, argv[1],
+                drv_None, NULL) ;
+        return ;
+    }
+
+    class_map_t const *cmap = find_class_map(portal, argv[2]) ;
+    if (cmap == NULL) {
+        drv_output(
+                drv_Code, codeStrings[code_Error],
+                drv_Result, "unknown class",
+                drv_Category, argv[0],
+                drv_Domain, argv[1],
+                drv_Class, argv[2],
+                drv_None, NULL) ;
+        return ;
+    }
+    /*
+     * Split the expression words into individual tokens. A braced word
+     * arrives as a single argument with embedded whitespace.
+     */
+    char exprBuf[BUFSIZ] ;
+    char const *tokens[MAX_CMD_ARGS] ;
+    int ntokens = 0 ;
+    size_t exprLen = 0 ;
+    for (int arg = 3 ; arg < argc ; ++arg) {
+        exprLen += snprintf(exprBuf + exprLen, sizeof(exprBuf) - exprLen,
+                arg == 3 ? "%s" : " %s", argv[arg]) ;
+        if (exprLen >= sizeof(exprBuf)) {
+            exprLen = sizeof(exprBuf) - 1 ;
+            break ;
+        }
+    }
+    char tokenBuf[BUFSIZ] ;
+    memcpy(tokenBuf, exprBuf, exprLen + 1) ;
+    for (char *tok = strtok(tokenBuf, " \t\r\n") ; tok != NULL &&
+            ntokens < (int)COUNTOF(tokens) ; tok = strtok(NULL, " \t\r\n")) {
+        tokens[ntokens++] = tok ;
+    }
+    /*
+     * Each run of tokens between "&&" becomes a predicate.
+     */
+    struct pycca_predicate preds[MAX_CMD_ARGS] ;
+    unsigned npreds = 0 ;
+    for (int first = 0 ; first < ntokens ; ) {
+        int last = first ;
+        while (last < ntokens && strcmp(tokens[last], "&&") != 0) {
+            ++last ;
+        }
+        char const *err = parse_predicate(cmap, tokens + first, last - first,
+                preds + npreds++) ;
+        if (err != NULL) {
+            drv_output(
+                    drv_Code, codeStrings[code_Error],
+                    drv_Result, err,
+                    drv_Category, argv[0],
+                    drv_Domain, argv[1],
+                    drv_Class, argv[2],
+                    drv_Value, exprBuf,
+                    drv_None, NULL) ;
+            return ;
+        }
+        first = last + 1 ;
+    }
+
+    struct pycca_domain_portal const *dportal = portal->dportal ;
+    InstId_t *ids = malloc(sizeof(InstId_t) *
+            (dportal->classes[cmap->id].numInsts + 1)) ;
+    if (ids == NULL) {
+        drv_output(
+                drv_Code, codeStrings[code_Error],
+                drv_Result, "out of memory",
+                drv_Category, argv[0],
+                drv_Domain, argv[1],
+                drv_Class, argv[2],
+                drv_None, NULL) ;
+        return ;
+    }
+    int count = pycca_select(dportal, cmap->id, preds, npreds, ids) ;
+    if (count < 0) {
+        free(ids) ;
+        drv_output(
+                drv_Code, codeStrings[code_Error],
+                drv_Result, count == PYCCA_PORTAL_NOT_SCALAR ?
+                    "attribute type does not match literal" :
+                    drv_format("select failed: %d", count),
+                drv_Category, argv[0],
+                drv_Domain, argv[1],
+                drv_Class, argv[2],
+                drv_Value, exprBuf,
+                drv_None, NULL) ;
+        return ;
+    }
+
+    struct drvBlock blk = {
+        .data = NULL,
+        .len = 0,
+        .cap = 0,
+    } ;
+    bool ok = true ;
+    for (int i = 0 ; ok && i < count ; ++i) {
+        ok = drv_block_printf(&blk, i == 0 ? "%u" : " %u", ids[i]) ;
+    }
+    ok = ok && drv_block_printf(&blk, "\r\n") ;
+    free(ids) ;
+
+    if (ok) {
+        char countStr[32] ;
+        snprintf(countStr, sizeof(countStr), "%d", count) ;
+        char lengthStr[32] ;
+        snprintf(lengthStr, sizeof(lengthStr), "%zu", blk.len) ;
+        drv_output(
+                drv_Code, codeStrings[code_Success],
+                drv_Result, countStr,
+                drv_Category, argv[0],
+                drv_Domain, argv[1],
+                drv_Class, argv[2],
+                drv_Length, lengthStr,
+                drv_None, NULL) ;
+        mechOutputAll(drvDataSock, blk.data, blk.len) ;
+    } else {
+        drv_output(
+                drv_Code, codeStrings[code_Error],
+                drv_Result, "out of memory",
+                drv_Category, argv[0],
+                drv_Domain, argv[1],
+                drv_Class, argv[2],
+                drv_None, NULL) ;
+    }
+    free(blk.data) ;
+}
+
+/*
+ * stats <domain>
+ *
+ * Report the counts of work done by the mechanisms. The result is a list of
+ * name / value pairs giving the number of events dispatched, the rate of
+ * dispatch in events per second since the previous "stats" command, the
+ * number of delayed events posted, the number of timer expirations, the
+ * number of periods missed by periodic events and the number of event
+ * control blocks in use along with the most ever in use.
+ * The counts cover all the domains, the domain argument being required only
+ * to follow the form of the other commands.
+ */
+static void
+statsCmd(
+    dportal_t const *portal,
+    int argc,
+    char const **argv)
+{
+    static MechTime lastTime ;
+    static unsigned long lastDispatched ;
+
+    MechStats stats = mechGetStats() ;
+    MechTime now = mechNow() ;
+    double elapsed = (now - lastTime) / 1000000.0 ;
+    double rate = lastTime != 0 && elapsed > 0.0 ?
+            (stats->eventsDispatched - lastDispatched) / elapsed : 0.0 ;
+    lastTime = now ;
+    lastDispatched = stats->eventsDispatched ;
+
+    drv_output(
+            drv_Code, codeStrings[code_Success],
+            drv_Result, drv_format(
+                "dispatched %lu rate %.1f delayed %lu expirations %lu "
+                "missed %lu ecbs %u ecbmax %u",
+                stats->eventsDispatched, rate, stats->delayedPosted,
+                stats->timerExpirations, stats->periodsMissed,
+                stats->ecbInUse,
+                stats->ecbMaxInUse),
+            drv_Category, argv[0],
+            drv_Domain, argv[1],
+            drv_None, NULL) ;
+}
+
 static void
 genEvent(
     struct pycca_domain_portal const *dportal,
@@ -1335,6 +1859,88 @@ find_polyevent_map(
             polyevent_map_compare) ;
 }
 
+/*
+ * Convert the tokens of one "select" term into a predicate.
+ * Returns NULL on success and an error message otherwise.
+ */
+static char const *
+parse_predicate(
+    class_map_t const *cmap,
+    char const *const *terms,
+    int nterms,
+    struct pycca_predicate *pred)
+{
+    static struct {
+        char const *name ;
+        enum pycca_compare compare ;
+    } const compareOps[] = {
+        {.name = "==", .compare = PYCCA_CMP_EQ},
+        {.name = "!=", .compare = PYCCA_CMP_NE},
+        {.name = "<",  .compare = PYCCA_CMP_LT},
+        {.name = "<=", .compare = PYCCA_CMP_LE},
+        {.name = ">",  .compare = PYCCA_CMP_GT},
+        {.name = ">=", .compare = PYCCA_CMP_GE},
+    } ;
+
+    if (nterms != 1 && nterms != 3) {
+        return "malformed term" ;
+    }
+
+    char const *attrName = terms[0] ;
+    bool negate = false ;
+    if (nterms == 1 && *attrName == '!') {
+        negate = true ;
+        ++attrName ;
+    }
+    attr_map_t const *amap = find_attr_map(cmap, attrName) ;
+    if (amap == NULL) {
+        return "unknown attribute" ;
+    }
+    pred->attr = amap->id ;
+
+    if (nterms == 1) {
+        pred->compare = negate ? PYCCA_CMP_EQ : PYCCA_CMP_NE ;
+        pred->type = PYCCA_VALUE_INT ;
+        pred->operand.i = 0 ;
+        return NULL ;
+    }
+
+    unsigned op ;
+    for (op = 0 ; op < COUNTOF(compareOps) ; ++op) {
+        if (strcmp(terms[1], compareOps[op].name) == 0) {
+            break ;
+        }
+    }
+    if (op >= COUNTOF(compareOps)) {
+        return "unknown comparison operator" ;
+    }
+    pred->compare = compareOps[op].compare ;
+
+    char const *literal = terms[2] ;
+    char *end ;
+    if (strcmp(literal, "true") == 0 || strcmp(literal, "false") == 0) {
+        pred->type = PYCCA_VALUE_INT ;
+        pred->operand.i = *literal == 't' ;
+        return NULL ;
+    }
+    bool isHex = strncmp(literal, "0x", 2) == 0 ||
+            strncmp(literal, "0X", 2) == 0 ;
+    if (!isHex && strpbrk(literal, ".eE") != NULL) {
+        pred->type = PYCCA_VALUE_FLOAT ;
+        pred->operand.f = strtod(literal, &end) ;
+    } else if (strpbrk(literal, "uU") != NULL) {
+        pred->type = PYCCA_VALUE_UINT ;
+        pred->operand.u = strtoull(literal, &end, 0) ;
+        if (*end == 'u' || *end == 'U') {
+            ++end ;
+        }
+    } else {
+        pred->type = PYCCA_VALUE_INT ;
+        pred->operand.i = strtoll(literal, &end, 0) ;
+    }
+    return end == literal || *end != '\0' ? "bad literal value" : NULL ;
+}
+
 static int
 wordparse(
     char *line,
@@ -50,6 +50,7 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <string.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <assert.h>
 #ifndef MECH_NINCL_STDIO
@@ -59,7 +60,12 @@
 #include <errno.h>
 #include <sys/select.h>
 #include <sys/time.h>
+#include <time.h>
 #include "mechs.h"
+#include "mechsIndex.h"
+#ifdef MECH_JOURNAL
+#   include "mechsJournal.h"
+#endif /* MECH_JOURNAL */
 #if defined(__GNUC__)
 #   define __WEAK  __attribute__((weak))
 #else
@@ -103,6 +109,8 @@ static char const * const errMsgs[] = {
     "no available Event Control Blocks\n",
     "no available instance slots: %p\n",
     "synchronization queue overflow\n",
+    "step end function overflow\n",
+    "no available payload blocks\n",
     #ifdef __unix__
     "interval timer operation failed: %s\n",
     "signal operation failed: %s\n",
@@ -180,6 +188,33 @@ mechInstIncrCounter(
     }
     return iab->allocCounter ;
 }
+/*
+ * The allocated instances of a class are kept on a list so that they can
+ * be visited without examining every slot. Instances of the initial
+ * population are allocated without passing through "mechInstCreate", so
+ * the list is built from the storage the first time it is needed.
+ */
+static void
+mechInstListAllocated(
+    InstAllocBlock iab)
+{
+    if (iab->allocListed) {
+        return ;
+    }
+    MechInstance *link = &iab->firstAlloc ;
+    MechInstance prev = NULL ;
+    for (MechInstance inst = iab->storageStart ;
+            (void *)inst < iab->storageFinish ;
+            inst = (MechInstance)((char *)inst + iab->instanceSize)) {
+        if (inst->alloc != 0) {
+            inst->prevAlloc = prev ;
+            *link = prev = inst ;
+            link = &inst->nextAlloc ;
+        }
+    }
+    *link = NULL ;
+    iab->allocListed = true ;
+}
 static MechInstance
 mechInstFindSlot(
     MechClass instClass)
@@ -231,9 +266,16 @@ mechInstCreate(
      */
     iab->storageLast = inst ;
     /*
-     * Mark the slot as in use.
+     * Mark the slot as in use and add it to the allocated instances.
      */
+    mechInstListAllocated(iab) ;
     inst->alloc = mechInstIncrCounter(iab) ;
+    inst->prevAlloc = NULL ;
+    inst->nextAlloc = iab->firstAlloc ;
+    if (iab->firstAlloc) {
+        iab->firstAlloc->prevAlloc = inst ;
+    }
+    iab->firstAlloc = inst ;
     inst->currentState = initialState ;
     inst->instClass = instClass ;
     /*
@@ -244,6 +286,13 @@ mechInstCreate(
     }
     return inst ;
 }
+/*
+ * The broadcast event that has been delivered to some of its targets and
+ * not yet to the rest. It stays ahead of every event that is not self
+ * directed until it is done, so there is at most one.
+ */
+static MechEcb broadcastInProgress ;
+static void broadcastInstDestroyed(MechInstance) ;
 void
 mechInstDestroy(
     MechInstance inst)
@@ -257,21 +306,173 @@ mechInstDestroy(
         iab->destruct(inst) ;
     }
     /*
-     * Mark the slot as free.
+     * Drop the instance from any identifier indexes.
+     */
+    mechIndexDetachInst(inst) ;
+    /*
+     * Any events still to be delivered to the instance go with it.
      */
+    mechEventCancelAllFor(inst) ;
+    /*
+     * A broadcast event part way through its targets may be due to reach
+     * the instance next.
+     */
+    if (broadcastInProgress != NULL) {
+        broadcastInstDestroyed(inst) ;
+    }
+    /*
+     * Mark the slot as free and take it off the allocated instances.
+     */
+    mechInstListAllocated(iab) ;
+    if (inst->prevAlloc) {
+        inst->prevAlloc->nextAlloc = inst->nextAlloc ;
+    } else {
+        iab->firstAlloc = inst->nextAlloc ;
+    }
+    if (inst->nextAlloc) {
+        inst->nextAlloc->prevAlloc = inst->prevAlloc ;
+    }
     inst->alloc = 0 ;
+    /*
+     * Leave off just before the freed slot so that the next creation
+     * finds it at once rather than searching the rest of the pool.
+     * Instances that are replaced by new ones, as happens with a
+     * large population, then do not cost a search each time.
+     */
+    iab->storageLast = inst == iab->storageStart ?
+            (char *)iab->storageFinish - iab->instanceSize :
+            (char *)inst - iab->instanceSize ;
 }
 bool mechInstAvail(
     MechClass instClass)
 {
     return mechInstFindSlot(instClass) != NULL ;
 }
+MechInstance
+mechInstFirstAllocated(
+    MechClass instClass)
+{
+    assert(instClass != NULL) ;
+    InstAllocBlock iab = instClass->iab ;
+    if (iab == NULL) {
+        return NULL ;
+    }
+    mechInstListAllocated(iab) ;
+    return iab->firstAlloc ;
+}
+MechInstance
+mechInstNextAllocated(
+    MechInstance inst)
+{
+    assert(inst != NULL) ;
+    assert(inst->alloc != 0) ;
+    return inst->nextAlloc ;
+}
+void
+mechInstRelistAllocated(
+    MechClass instClass)
+{
+    if (instClass != NULL && instClass->iab != NULL) {
+        instClass->iab->allocListed = false ;
+    }
+}
+void
+mechInstRestoreAllocated(
+    MechClass instClass,
+    MechInstance first)
+{
+    if (instClass != NULL && instClass->iab != NULL) {
+        instClass->iab->firstAlloc = first ;
+        instClass->iab->allocListed = first != NULL ;
+    }
+}
+/*
+ * In the compact layout, the ECBs used as queue terminals are kept at the
+ * end of the pool so that they may be linked by index like any other.
+ */
+#ifdef MECH_ECB_COMPACT
+#   if MECH_EVENTPOOLSIZE + 4 >= UINT16_MAX
+#       error "MECH_EVENTPOOLSIZE is too large for MECH_ECB_COMPACT"
+#   endif
+static struct mechecb mechECBPool[MECH_EVENTPOOLSIZE + 4] ;
+#   define eventQueue          (mechECBPool[MECH_EVENTPOOLSIZE])
+#   define delayedEventQueue   (mechECBPool[MECH_EVENTPOOLSIZE + 1])
+#   define suspendedEventQueue (mechECBPool[MECH_EVENTPOOLSIZE + 2])
+#   define freeEventQueue      (mechECBPool[MECH_EVENTPOOLSIZE + 3])
+/*
+ * Fail to compile if the layout does not come out within 64 bytes.
+ */
+typedef char mechEcbSizeCheck[sizeof(struct mechecb) <= 64 ? 1 : -1] ;
+static inline
+MechEcb
+ecbOfLink(
+    MechEcbLink link)
+{
+    return link == MECH_ECB_NOLINK ? NULL : mechECBPool + (link - 1) ;
+}
+static inline
+MechEcbLink
+linkOfEcb(
+    MechEcb ecb)
+{
+    return ecb == NULL ?
+            MECH_ECB_NOLINK : (MechEcbLink)(ecb - mechECBPool + 1) ;
+}
+#else
+static struct mechecb mechECBPool[MECH_EVENTPOOLSIZE] ;
+static struct mechecb eventQueue ;
+static struct mechecb delayedEventQueue ;
+static struct mechecb suspendedEventQueue ;
+static struct mechecb freeEventQueue ;
+/*
+ * Fail to compile if the default layout grows beyond the 112 bytes it takes
+ * on 64-bit hosts, so that the compact layout costs nothing when unused.
+ */
+#   if UINTPTR_MAX == UINT64_MAX
+typedef char mechEcbSizeCheck[sizeof(struct mechecb) <= 112 ? 1 : -1] ;
+#   endif
+static inline
+MechEcb
+ecbOfLink(
+    MechEcbLink link)
+{
+    return link ;
+}
+static inline
+MechEcbLink
+linkOfEcb(
+    MechEcb ecb)
+{
+    return ecb ;
+}
+#endif /* MECH_ECB_COMPACT */
+static inline
+struct mechecb *
+ecbNext(
+    MechEcb iter)
+{
+    return ecbOfLink(iter->next) ;
+}
+static inline
+struct mechecb *
+ecbPrev(
+    MechEcb iter)
+{
+    return ecbOfLink(iter->prev) ;
+}
+static inline
+void
+eventQueueInit(
+    MechEcb queue)
+{
+    queue->next = queue->prev = linkOfEcb(queue) ;
+}
 static inline
 struct mechecb *
 eventQueueBegin(
     MechEcb iter)
 {
-    return iter->next ;
+    return ecbNext(iter) ;
 }
 static inline
 struct mechecb *
@@ -285,7 +486,7 @@ bool
 eventQueueEmpty(
     MechEcb iter)
 {
-    return iter->next == iter ;
+    return iter->next == linkOfEcb(iter) ;
 }
 static inline
 void
@@ -294,22 +495,47 @@ eventQueueInsert(
     MechEcb at)
 {
     item->prev = at->prev ;
-    item->next = at ;
-    at->prev->next = item ;
-    at->prev = item ;
+    item->next = linkOfEcb(at) ;
+    ecbPrev(at)->next = linkOfEcb(item) ;
+    at->prev = linkOfEcb(item) ;
 }
 static inline
 void
 eventQueueRemove(
     MechEcb item)
 {
-    item->prev->next = item->next ;
-    item->next->prev = item->prev ;
+    ecbPrev(item)->next = item->next ;
+    ecbNext(item)->prev = item->prev ;
 }
-static struct mechecb mechECBPool[MECH_EVENTPOOLSIZE] ;
-static struct mechecb eventQueue ;
-static struct mechecb delayedEventQueue ;
-static struct mechecb freeEventQueue ;
+static struct mechstats mechStats ;
+static MechEcb periodicInDispatch ;
+#if MECH_PAYLOADPOOLSIZE > 0
+/*
+ * Payload blocks are kept on a free list through their first member.
+ * The data union gives the bytes the alignment of any parameter type.
+ */
+typedef struct mechpayload {
+    struct mechpayload *nextFree ;
+    RefCount referenceCount ;
+    union {
+        long double ldparm ;
+        uint64_t u64parm ;
+        void *pparm ;
+        unsigned char bytes[MECH_PAYLOAD_SIZE] ;
+    } data ;
+} *MechPayload ;
+static struct mechpayload mechPayloadPool[MECH_PAYLOADPOOLSIZE] ;
+static MechPayload freePayloads ;
+static void
+mechPayloadInit(void)
+{
+    for (MechPayload pl = mechPayloadPool ;
+            pl < mechPayloadPool + MECH_PAYLOADPOOLSIZE ; ++pl) {
+        pl->nextFree = freePayloads ;
+        freePayloads = pl ;
+    }
+}
+#endif /* MECH_PAYLOADPOOLSIZE > 0 */
 static void
 mechEventInit(void)
 {
@@ -317,10 +543,10 @@ mechEventInit(void)
     /*
      * Initialize the ECB used as the queue terminus.
      */
-    eventQueue.next = eventQueue.prev = &eventQueue ;
-    delayedEventQueue.next = delayedEventQueue.prev =
-            &delayedEventQueue ;
-    freeEventQueue.next = freeEventQueue.prev = &freeEventQueue ;
+    eventQueueInit(&eventQueue) ;
+    eventQueueInit(&delayedEventQueue) ;
+    eventQueueInit(&suspendedEventQueue) ;
+    eventQueueInit(&freeEventQueue) ;
     /*
      * Place all the event control blocks on the free event
      * queue.  Allocation occurs from there.
@@ -329,6 +555,9 @@ mechEventInit(void)
             ecb < mechECBPool + MECH_EVENTPOOLSIZE ; ++ecb) {
         eventQueueInsert(ecb, &freeEventQueue) ;
     }
+#   if MECH_PAYLOADPOOLSIZE > 0
+    mechPayloadInit() ;
+#   endif /* MECH_PAYLOADPOOLSIZE > 0 */
 }
 static inline 
 MechEcb
@@ -338,11 +567,73 @@ mechEventAlloc(void)
         mechFatalError(mechNoECB) ;
     }
 
-    MechEcb ecb = freeEventQueue.next ;
+    MechEcb ecb = eventQueueBegin(&freeEventQueue) ;
     eventQueueRemove(ecb) ;
     ecb->referenceCount = 0 ;
+    ecb->delayed = false ;
+    ecb->suspended = false ;
+    ecb->hasPayload = false ;
+    ecb->ext.periodic.period = 0 ;
+    if (++mechStats.ecbInUse > mechStats.ecbMaxInUse) {
+        mechStats.ecbMaxInUse = mechStats.ecbInUse ;
+    }
     return ecb ;
 }
+#if MECH_PAYLOADPOOLSIZE > 0
+static inline
+MechPayload
+payloadOfData(
+    void *payload)
+{
+    MechPayload pl = (MechPayload)((char *)payload -
+            offsetof(struct mechpayload, data)) ;
+    assert(pl >= mechPayloadPool &&
+            pl < mechPayloadPool + MECH_PAYLOADPOOLSIZE) ;
+    assert(pl->referenceCount != 0) ;
+    return pl ;
+}
+void *
+mechPayloadAlloc(void)
+{
+    if (freePayloads == NULL) {
+        mechFatalError(mechNoPayload) ;
+    }
+    MechPayload pl = freePayloads ;
+    freePayloads = pl->nextFree ;
+    pl->referenceCount = 1 ;
+    return &pl->data ;
+}
+void
+mechPayloadRetain(
+    void *payload)
+{
+    MechPayload pl = payloadOfData(payload) ;
+    assert(pl->referenceCount < UINT8_MAX) ;
+    ++pl->referenceCount ;
+}
+void
+mechPayloadRelease(
+    void *payload)
+{
+    MechPayload pl = payloadOfData(payload) ;
+    if (--pl->referenceCount == 0) {
+        pl->nextFree = freePayloads ;
+        freePayloads = pl ;
+    }
+}
+void
+mechEventAttachPayload(
+    MechEcb ecb,
+    void *payload)
+{
+    assert(ecb != NULL) ;
+    assert(!ecb->hasPayload) ;
+    payloadOfData(payload) ;
+
+    ecb->eventParameters.pparm[0] = payload ;
+    ecb->hasPayload = true ;
+}
+#endif /* MECH_PAYLOADPOOLSIZE > 0 */
 static void
 mechEventDelete(
     MechEcb ecb)
@@ -350,7 +641,13 @@ mechEventDelete(
     assert(ecb != NULL) ;
 
     if (ecb->referenceCount <= 1) {
+#       if MECH_PAYLOADPOOLSIZE > 0
+        if (ecb->hasPayload) {
+            mechPayloadRelease(ecb->eventParameters.pparm[0]) ;
+        }
+#       endif /* MECH_PAYLOADPOOLSIZE > 0 */
         eventQueueInsert(ecb, &freeEventQueue) ;
+        --mechStats.ecbInUse ;
     } else {
         --ecb->referenceCount ;
     }
@@ -426,6 +723,39 @@ mechCreationEventNew(
 
     return ecb ;
 }
+/*
+ * The cursor of a broadcast event is the storage slot of the next instance
+ * on the allocated list of its class to which it is to be delivered, or
+ * one of these.
+ */
+#define BROADCAST_UNSTARTED     UINT16_MAX
+#define BROADCAST_FINISHED      (UINT16_MAX - 1)
+MechEcb
+mechBroadcastEventNew(
+    EventCode event,
+    MechClass targetClass,
+    MechInstPredicate predicate,
+    MechInstance srcInst)
+{
+    assert(targetClass != NULL) ;
+    assert(targetClass->iab != NULL) ;
+    assert(targetClass->odb != NULL) ;
+    assert((char *)targetClass->iab->storageFinish -
+            (char *)targetClass->iab->storageStart <
+            BROADCAST_FINISHED * targetClass->iab->instanceSize) ;
+
+    MechEcb ecb = mechEventAlloc() ;
+
+    ecb->eventNumber = event ;
+    ecb->eventType = BroadcastEvent ;
+    ecb->instOrClass.targetClass = targetClass ;
+    ecb->srcInst = srcInst ;
+    ecb->alloc = 0 ;
+    ecb->pos.cursor = BROADCAST_UNSTARTED ;
+    ecb->ext.predicate = predicate ;
+
+    return ecb ;
+}
 static inline 
 RefCount
 mechEventIncrRef(
@@ -433,25 +763,129 @@ mechEventIncrRef(
 {
     return ++ecb->referenceCount ;
 }
+/*
+ * Events that are queued, delayed or suspended for an instance are
+ * indexed by the target instance so that they may all be found when the
+ * instance is deleted. Creation and broadcast events target a class and
+ * are not indexed.
+ */
+static MechEcbLink instEventIndex[MECH_INSTEVENTINDEXSIZE] ;
+static inline
+MechEcbLink *
+instEventIndexBucket(
+    MechInstance targetInst)
+{
+    return instEventIndex +
+            ((uintptr_t)targetInst >> 3) % MECH_INSTEVENTINDEXSIZE ;
+}
+static inline
+bool
+instEventIndexed(
+    MechEcb ecb)
+{
+    return ecb->eventType == NormalEvent ||
+            ecb->eventType == PolymorphicEvent ;
+}
+static inline
+void
+instEventIndexInsert(
+    MechEcb ecb)
+{
+    if (instEventIndexed(ecb)) {
+        MechEcbLink *bucket =
+                instEventIndexBucket(ecb->instOrClass.targetInst) ;
+        ecb->instLink = *bucket ;
+        ecb->pos.instPrev = MECH_ECB_NOLINK ;
+        if (*bucket != MECH_ECB_NOLINK) {
+            ecbOfLink(*bucket)->pos.instPrev = linkOfEcb(ecb) ;
+        }
+        *bucket = linkOfEcb(ecb) ;
+    }
+}
+/*
+ * Unlink an event from its bucket. The back link makes this independent
+ * of the length of the bucket chain.
+ */
+static inline
+void
+instEventIndexUnlink(
+    MechEcb ecb)
+{
+    MechEcb prev = ecbOfLink(ecb->pos.instPrev) ;
+    MechEcb next = ecbOfLink(ecb->instLink) ;
+    if (prev) {
+        prev->instLink = ecb->instLink ;
+    } else {
+        *instEventIndexBucket(ecb->instOrClass.targetInst) = ecb->instLink ;
+    }
+    if (next) {
+        next->pos.instPrev = ecb->pos.instPrev ;
+    }
+}
+static inline
+void
+instEventIndexRemove(
+    MechEcb ecb)
+{
+    if (instEventIndexed(ecb)) {
+        instEventIndexUnlink(ecb) ;
+    }
+}
+/*
+ * Find the earliest event from "srcInst" to "targetInst" that is on the
+ * event queue. The index holds the most recently posted events first, so
+ * the last one that matches is the earliest.
+ */
+static MechEcb
+instEventFindQueued(
+    MechInstance srcInst,
+    MechInstance targetInst,
+    EventCode event)
+{
+    MechEcb found = NULL ;
+    for (MechEcb iter = ecbOfLink(*instEventIndexBucket(targetInst)) ;
+            iter != NULL ; iter = ecbOfLink(iter->instLink)) {
+        if (!iter->delayed && iter->srcInst == srcInst &&
+                iter->instOrClass.targetInst == targetInst &&
+                iter->eventNumber == event) {
+            found = iter ;
+        }
+    }
+    return found ;
+}
+#ifdef MECH_JOURNAL
+/*
+ * Events posted while an event is being dispatched are generated by
+ * actions. All others come from outside of the domains.
+ */
+static bool mechInDispatch ;
+#endif /* MECH_JOURNAL */
 void
 mechEventPost(
     MechEcb ecb)
 {
+#   ifdef MECH_JOURNAL
+    mechJournalEvent(ecb, 0, !mechInDispatch) ;
+#   endif /* MECH_JOURNAL */
     mechEventIncrRef(ecb) ;
     eventQueueInsert(ecb, &eventQueue) ;
+    instEventIndexInsert(ecb) ;
 }
 void
 mechEventPostSelf(
     MechEcb ecb)
 {
     assert(ecb->instOrClass.targetInst == ecb->srcInst) ;
+#   ifdef MECH_JOURNAL
+    mechJournalEvent(ecb, 0, !mechInDispatch) ;
+#   endif /* MECH_JOURNAL */
     /*
      * Find the first event that is not self-directed.
      */
     MechEcb iter ;
     for (iter = eventQueueBegin(&eventQueue) ;
             iter != eventQueueEnd(&eventQueue) ;
-            iter = iter->next) {
+            iter = ecbNext(iter)) {
         if (iter->srcInst != iter->instOrClass.targetInst) {
             break ;
         }
@@ -459,6 +893,7 @@ mechEventPostSelf(
 
     mechEventIncrRef(ecb) ;
     eventQueueInsert(ecb, iter) ;
+    instEventIndexInsert(ecb) ;
 }
 bool
 mechEventAvail(void)
@@ -467,20 +902,38 @@ mechEventAvail(void)
 }
 static void sysTimerStart(MechDelayTime) ;
 static MechDelayTime sysTimerStop(void) ;
+/*
+ * Delayed and suspended events are indexed by their source, target
+ * and event number so that they may be found without walking the
+ * delayed event queue. Each ECB in the index records the time at which
+ * it expires, measured by "delayedQueueClock", which advances only as
+ * the timer runs off the delays of the queue.
+ */
+static MechEcbLink delayedIndex[MECH_DELAYINDEXSIZE] ;
+static MechDelayTime delayedQueueClock ;
+static MechDelayTime delayedQueueTimer ;
+
+static inline
+MechEcbLink *
+delayedIndexBucket(
+    MechInstance srcInst,
+    MechInstance targetInst,
+    EventCode event)
+{
+    uintptr_t hash = (uintptr_t)targetInst >> 3 ;
+    hash = hash * 31 + ((uintptr_t)srcInst >> 3) ;
+    hash = hash * 31 + event ;
+    return delayedIndex + hash % MECH_DELAYINDEXSIZE ;
+}
 static MechEcb
-findEvent(
-    MechEcb queue,
+delayedIndexFind(
     MechInstance srcInst,
     MechInstance targetInst,
     EventCode event)
 {
-    /*
-     * Simple iteration through the list of events
-     * in the queue.
-     */
-    for (MechEcb iter = eventQueueBegin(queue) ;
-            iter != eventQueueEnd(queue) ;
-            iter = iter->next) {
+    for (MechEcb iter =
+                ecbOfLink(*delayedIndexBucket(srcInst, targetInst, event)) ;
+            iter != NULL ; iter = ecbOfLink(iter->delayLink)) {
         if (iter->srcInst == srcInst &&
                 iter->instOrClass.targetInst == targetInst &&
                 iter->eventNumber == event) {
@@ -489,10 +942,38 @@ findEvent(
     }
     return NULL ;
 }
+static inline
+void
+delayedIndexInsert(
+    MechEcb ecb)
+{
+    MechEcbLink *bucket = delayedIndexBucket(ecb->srcInst,
+            ecb->instOrClass.targetInst, ecb->eventNumber) ;
+    ecb->delayLink = *bucket ;
+    *bucket = linkOfEcb(ecb) ;
+}
+static void
+delayedIndexRemove(
+    MechEcb ecb)
+{
+    for (MechEcbLink *link = delayedIndexBucket(ecb->srcInst,
+                ecb->instOrClass.targetInst, ecb->eventNumber) ;
+            *link != MECH_ECB_NOLINK ;
+            link = &ecbOfLink(*link)->delayLink) {
+        if (ecbOfLink(*link) == ecb) {
+            *link = ecb->delayLink ;
+            break ;
+        }
+    }
+}
 static void
 insertIntoDelayedQueue(
     MechEcb ecb)
 {
+    ecb->expire = delayedQueueClock + ecb->delay ;
+    ecb->delayed = true ;
+    ecb->suspended = false ;
+    delayedIndexInsert(ecb) ;
     /*
      * We walk down the queue to find the correct slot.
      * That slot is the first place in the queue where our
@@ -505,7 +986,7 @@ insertIntoDelayedQueue(
     MechEcb iter ;
     for (iter = eventQueueBegin(&delayedEventQueue) ;
             iter != eventQueueEnd(&delayedEventQueue) ;
-            iter = iter->next) {
+            iter = ecbNext(iter)) {
         /*
          * By keeping this comparison to be strictly less
          * than, we preserve the order of event dispatch to
@@ -539,7 +1020,7 @@ insertIntoDelayedQueue(
     mechEventIncrRef(ecb) ;
 }
 static void
-removeFromDelayedQueue(
+unlinkFromDelayedQueue(
     MechEcb ecb)
 {
     /*
@@ -547,13 +1028,29 @@ removeFromDelayedQueue(
      * from the removed entry is accumulated on the next
      * entry in the queue.
      */
-    if (ecb->next != eventQueueEnd(&delayedEventQueue)) {
-        ecb->next->delay += ecb->delay ;
+    if (ecbNext(ecb) != eventQueueEnd(&delayedEventQueue)) {
+        ecbNext(ecb)->delay += ecb->delay ;
     }
     /*
      * Remove the ECB from the delayed queue.
      */
     eventQueueRemove(ecb) ;
+}
+static void
+removeFromDelayedQueue(
+    MechEcb ecb)
+{
+    delayedIndexRemove(ecb) ;
+    instEventIndexRemove(ecb) ;
+    /*
+     * Suspended events are held on their own queue and do not
+     * contribute to the delays of the delayed queue.
+     */
+    if (ecb->suspended) {
+        eventQueueRemove(ecb) ;
+    } else {
+        unlinkFromDelayedQueue(ecb) ;
+    }
     /*
      * Return the ECB back to the pool.
      */
@@ -568,7 +1065,7 @@ expireDelayedEvents(void)
      */
     for (MechEcb iter = eventQueueBegin(&delayedEventQueue) ;
             iter != eventQueueEnd(&delayedEventQueue) ;
-            iter = iter->next) {
+            iter = ecbNext(iter)) {
         if (iter->delay == 0) {
             /*
              * Mark all the events that have zero delay time
@@ -611,13 +1108,15 @@ transferExpiredEvents(void)
          * queue.
          */
         MechEcb ecb = iter ;
-        iter = iter->next ;
+        iter = ecbNext(iter) ;
 
         /*
          * Remove the ECB from the delayed queue and insert
          * it into event queue for dispatch.
          */
+        delayedIndexRemove(ecb) ;
         eventQueueRemove(ecb) ;
+        ecb->delayed = false ;
         eventQueueInsert(ecb, &eventQueue) ;
         assert(ecb->referenceCount != 0) ;
     }
@@ -628,6 +1127,7 @@ startDelayedQueueTiming(void)
     if (!eventQueueEmpty(&delayedEventQueue)) {
         MechEcb ecb = eventQueueBegin(&delayedEventQueue) ;
         assert(ecb->delay != 0) ;
+        delayedQueueTimer = ecb->delay ;
         sysTimerStart(ecb->delay) ;
         ecb->delay = 0 ;
     }
@@ -644,6 +1144,13 @@ stopDelayedQueueTiming(void)
          * Stop the timer, obtaining the residual time.
          */
         MechDelayTime remain = sysTimerStop() ;
+        /*
+         * Account for the time the timer has run.
+         */
+        if (remain < delayedQueueTimer) {
+            delayedQueueClock += delayedQueueTimer - remain ;
+        }
+        delayedQueueTimer = 0 ;
         /*
          * There are two cases here. It is possible for the
          * remaining time returned from sysTimerStop() to be
@@ -721,6 +1228,10 @@ mechEventPostDelay(
         mechEventPost(ecb) ;
         return ;
     }
+#   ifdef MECH_JOURNAL
+    mechJournalEvent(ecb, time, !mechInDispatch) ;
+#   endif /* MECH_JOURNAL */
+    ++mechStats.delayedPosted ;
     ecb->delay = mechMsecToTicks(time) ;
     /*
      * Stop the timing queue so we may examine it.
@@ -729,9 +1240,8 @@ mechEventPostDelay(
     /*
      * If the event already exists, remove it.
      */
-    MechEcb prevEvent = findEvent(&delayedEventQueue,
-            ecb->srcInst, ecb->instOrClass.targetInst,
-            ecb->eventNumber) ;
+    MechEcb prevEvent = delayedIndexFind(ecb->srcInst,
+            ecb->instOrClass.targetInst, ecb->eventNumber) ;
     if (prevEvent) {
         removeFromDelayedQueue(prevEvent) ;
     }
@@ -739,6 +1249,7 @@ mechEventPostDelay(
      * Insert the new event.
      */
     insertIntoDelayedQueue(ecb) ;
+    instEventIndexInsert(ecb) ;
     assert(!eventQueueEmpty(&delayedEventQueue)) ;
     /*
      * Start the timer to expire for the first event
@@ -753,15 +1264,26 @@ mechEventDelayCancel(
     MechInstance srcInst)
 {
     assert(targetInst != NULL) ;
+    /*
+     * A periodic event that is being dispatched is on no queue. Clearing
+     * its period keeps it from being posted again when the dispatch
+     * completes.
+     */
+    if (periodicInDispatch != NULL &&
+            periodicInDispatch->eventNumber == event &&
+            periodicInDispatch->instOrClass.targetInst == targetInst &&
+            periodicInDispatch->srcInst == srcInst) {
+        periodicInDispatch->ext.periodic.period = 0 ;
+        return ;
+    }
     /*
      * Stop delayed queue so that we may examine it.
      */
     stopDelayedQueueTiming() ;
     /*
-     * Search for the event in the delayed event queue.
+     * Search for the event among the delayed and suspended events.
      */
-    MechEcb foundEvent = findEvent(&delayedEventQueue,
-            srcInst, targetInst, event) ;
+    MechEcb foundEvent = delayedIndexFind(srcInst, targetInst, event) ;
     if (foundEvent) {
         /*
          * Removing from the delayed queue requires
@@ -771,19 +1293,20 @@ mechEventDelayCancel(
     } else {
         /*
          * If the event is not in the delayed queue, then
-         * search the event queue. The timer could have
-         * expired and the event placed in the queue.
+         * look for it among the events queued for the target.
+         * The timer could have expired and the event placed
+         * in the queue.
          */
-        foundEvent = findEvent(&eventQueue, srcInst,
-                targetInst, event) ;
+        foundEvent = instEventFindQueued(srcInst, targetInst, event) ;
         if (foundEvent) {
             eventQueueRemove(foundEvent) ;
+            instEventIndexRemove(foundEvent) ;
             mechEventDelete(foundEvent) ;
         }
         /*
          * We can get here, without finding the event in the
          * delayed queue or the event queue.
-         * That's okay, it just amounts to an expensive
+         * That's okay, it just amounts to a
          * no-op and implies that the event has expired,
          * was queued and has already been dispatched or
          * had never been generated at all.
@@ -791,6 +1314,82 @@ mechEventDelayCancel(
     }
     startDelayedQueueTiming() ;
 }
+void
+mechEventPostPeriodic(
+    MechEcb ecb,
+    MechDelayTime period)
+{
+    assert(ecb != NULL) ;
+    assert(ecb->eventType == NormalEvent) ;
+    assert(period != 0) ;
+    /*
+     * The deadlines are kept in milliseconds of "mechNow" time so that
+     * each one follows from the last by exactly one period, however late
+     * the event was dispatched.
+     */
+    ecb->ext.periodic.period = period ;
+    ecb->ext.periodic.deadline = (MechEcbTime)(mechNow() / 1000) + period ;
+    mechEventPostDelay(ecb, period) ;
+}
+void
+mechEventPeriodicCancel(
+    EventCode event,
+    MechInstance targetInst,
+    MechInstance srcInst)
+{
+    mechEventDelayCancel(event, targetInst, srcInst) ;
+}
+static void
+rearmPeriodicEvent(
+    MechEcb ecb)
+{
+    MechEcbTime period = ecb->ext.periodic.period ;
+    MechEcbTime now = (MechEcbTime)(mechNow() / 1000) ;
+    MechEcbTime deadline = ecb->ext.periodic.deadline + period ;
+    /*
+     * The times are compared by their unsigned difference so that a
+     * deadline held in 32 bits may wrap around.
+     */
+    MechEcbTime late = now - deadline ;
+    if (late != 0 && late < (MechEcbTime)~(MechEcbTime)0 / 2) {
+        /*
+         * Skip the periods whose deadlines have already passed. A deadline
+         * that falls due just now is not missed.
+         */
+        MechEcbTime missed = (late - 1) / period + 1 ;
+        deadline += missed * period ;
+        mechStats.periodsMissed += missed ;
+    }
+    ecb->ext.periodic.deadline = deadline ;
+
+    stopDelayedQueueTiming() ;
+    /*
+     * If the action posted the same event again itself, that event
+     * supersedes the periodic one.
+     */
+    if (delayedIndexFind(ecb->srcInst, ecb->instOrClass.targetInst,
+            ecb->eventNumber) == NULL) {
+        MechDelayTime delay =
+                mechMsecToTicks((MechDelayTime)(deadline - now)) ;
+        if (delay != 0) {
+            ecb->delay = delay ;
+            insertIntoDelayedQueue(ecb) ;
+        } else {
+            /*
+             * The next deadline falls due just now, when dispatch was a
+             * whole number of periods late. No time is left to run, so
+             * the event is queued for dispatch as if its timer had
+             * expired.
+             */
+            ecb->delayed = false ;
+            eventQueueInsert(ecb, &eventQueue) ;
+            mechEventIncrRef(ecb) ;
+        }
+        instEventIndexInsert(ecb) ;
+        ++mechStats.delayedPosted ;
+    }
+    startDelayedQueueTiming() ;
+}
 MechDelayTime
 mechEventDelayRemaining(
     EventCode event,
@@ -801,30 +1400,187 @@ mechEventDelayRemaining(
 
     stopDelayedQueueTiming() ;
     /*
-     * Iterate through the delayed event time and sum all
-     * the delay times to give the total amount of time
-     * remaining for the found event.
+     * The time remaining is the difference between when the event
+     * expires and the current time. Suspended events hold their
+     * remaining time as their delay.
+     * If we didn't find the event, the just return 0.
      */
     MechDelayTime remain = 0 ;
-    MechEcb iter ;
-    for (iter = eventQueueBegin(&delayedEventQueue) ;
-            iter != eventQueueEnd(&delayedEventQueue) ;
-            iter = iter->next) {
-        remain += iter->delay ;
-        if (iter->srcInst == srcInst &&
-                iter->instOrClass.targetInst == targetInst &&
-                iter->eventNumber == event) {
-            break ;
+    MechEcb foundEvent = delayedIndexFind(srcInst, targetInst, event) ;
+    if (foundEvent) {
+        remain = foundEvent->suspended ?
+                foundEvent->delay : foundEvent->expire - delayedQueueClock ;
+    }
+    startDelayedQueueTiming() ;
+
+    return mechTicksToMsec(remain) ;
+}
+MechDelayTime
+mechEventDelaySuspend(
+    EventCode event,
+    MechInstance targetInst,
+    MechInstance srcInst)
+{
+    assert(targetInst != NULL) ;
+
+    stopDelayedQueueTiming() ;
+    MechDelayTime remain = 0 ;
+    MechEcb foundEvent = delayedIndexFind(srcInst, targetInst, event) ;
+    if (foundEvent && !foundEvent->suspended) {
+        /*
+         * Take the event off the delayed queue, keeping it in the index
+         * and retaining the reference the queue held. The delay of a
+         * suspended event is the time it has remaining.
+         */
+        remain = foundEvent->expire - delayedQueueClock ;
+        unlinkFromDelayedQueue(foundEvent) ;
+        foundEvent->delay = remain ;
+        foundEvent->suspended = true ;
+        eventQueueInsert(foundEvent, &suspendedEventQueue) ;
+    } else if (foundEvent) {
+        remain = foundEvent->delay ;
+    }
+    startDelayedQueueTiming() ;
+
+    return mechTicksToMsec(remain) ;
+}
+bool
+mechEventDelayResume(
+    EventCode event,
+    MechInstance targetInst,
+    MechInstance srcInst)
+{
+    assert(targetInst != NULL) ;
+
+    MechEcb foundEvent = delayedIndexFind(srcInst, targetInst, event) ;
+    if (foundEvent == NULL || !foundEvent->suspended) {
+        return false ;
+    }
+    /*
+     * Remove the event from the index and suspended queue and time it
+     * again as if it were newly posted for its remaining time.
+     * The reference held for the queue is carried over.
+     */
+    stopDelayedQueueTiming() ;
+    delayedIndexRemove(foundEvent) ;
+    eventQueueRemove(foundEvent) ;
+    insertIntoDelayedQueue(foundEvent) ;
+    --foundEvent->referenceCount ;
+    startDelayedQueueTiming() ;
+
+    return true ;
+}
+void
+mechEventCancelAllFor(
+    MechInstance targetInst)
+{
+    assert(targetInst != NULL) ;
+
+    MechEcb ecb = ecbOfLink(*instEventIndexBucket(targetInst)) ;
+    if (ecb == NULL) {
+        return ;
+    }
+    stopDelayedQueueTiming() ;
+    for (MechEcb next ; ecb != NULL ; ecb = next) {
+        next = ecbOfLink(ecb->instLink) ;
+        if (ecb->instOrClass.targetInst != targetInst) {
+            continue ;
         }
+        instEventIndexUnlink(ecb) ;
+        if (ecb->delayed) {
+            delayedIndexRemove(ecb) ;
+            if (ecb->suspended) {
+                eventQueueRemove(ecb) ;
+            } else {
+                unlinkFromDelayedQueue(ecb) ;
+            }
+        } else {
+            eventQueueRemove(ecb) ;
+        }
+        mechEventDelete(ecb) ;
     }
     startDelayedQueueTiming() ;
+}
+#ifdef MECH_JOURNAL
+void
+mechEventForEachPending(
+    MechPendingFunc func,
+    void *arg)
+{
+    for (MechEcb iter = eventQueueBegin(&eventQueue) ;
+            iter != eventQueueEnd(&eventQueue) ;
+            iter = ecbNext(iter)) {
+        func(iter, 0, arg) ;
+    }
+
+    stopDelayedQueueTiming() ;
     /*
-     * Return the amount of time remaining for the event.
-     * If we didn't find the event, the just return 0.
+     * Delayed events hold their delay relative to the previous entry in
+     * the queue. Accumulate them to give the time remaining for each.
+     */
+    MechDelayTime remain = 0 ;
+    for (MechEcb iter = eventQueueBegin(&delayedEventQueue) ;
+            iter != eventQueueEnd(&delayedEventQueue) ;
+            iter = ecbNext(iter)) {
+        remain += iter->delay ;
+        func(iter, mechTicksToMsec(remain), arg) ;
+    }
+    /*
+     * Suspended events hold the time they have remaining.
      */
-    return iter == eventQueueEnd(&delayedEventQueue) ?
-            0 : mechTicksToMsec(remain) ;
+    for (MechEcb iter = eventQueueBegin(&suspendedEventQueue) ;
+            iter != eventQueueEnd(&suspendedEventQueue) ;
+            iter = ecbNext(iter)) {
+        func(iter, mechTicksToMsec(iter->delay), arg) ;
+    }
+    startDelayedQueueTiming() ;
+}
+void
+mechEventPostSuspended(
+    MechEcb ecb,
+    MechDelayTime remain)
+{
+    assert(ecb != NULL) ;
+    assert(ecb->eventType == NormalEvent ||
+            ecb->eventType == PolymorphicEvent) ;
+    assert(delayedIndexFind(ecb->srcInst, ecb->instOrClass.targetInst,
+            ecb->eventNumber) == NULL) ;
+
+    ecb->delay = mechMsecToTicks(remain) ;
+    ecb->delayed = true ;
+    ecb->suspended = true ;
+    delayedIndexInsert(ecb) ;
+    eventQueueInsert(ecb, &suspendedEventQueue) ;
+    mechEventIncrRef(ecb) ;
+    instEventIndexInsert(ecb) ;
+}
+void
+mechEventPurgeAll(void)
+{
+    stopDelayedQueueTiming() ;
+    while (!eventQueueEmpty(&delayedEventQueue)) {
+        MechEcb ecb = eventQueueBegin(&delayedEventQueue) ;
+        delayedIndexRemove(ecb) ;
+        instEventIndexRemove(ecb) ;
+        eventQueueRemove(ecb) ;
+        mechEventDelete(ecb) ;
+    }
+    while (!eventQueueEmpty(&suspendedEventQueue)) {
+        MechEcb ecb = eventQueueBegin(&suspendedEventQueue) ;
+        delayedIndexRemove(ecb) ;
+        instEventIndexRemove(ecb) ;
+        eventQueueRemove(ecb) ;
+        mechEventDelete(ecb) ;
+    }
+    while (!eventQueueEmpty(&eventQueue)) {
+        MechEcb ecb = eventQueueBegin(&eventQueue) ;
+        instEventIndexRemove(ecb) ;
+        eventQueueRemove(ecb) ;
+        mechEventDelete(ecb) ;
+    }
+    broadcastInProgress = NULL ;
 }
+#endif /* MECH_JOURNAL */
 static void
 sysTimerMask(void)
 {
@@ -880,11 +1636,24 @@ sysTimerStop(void)
         mechFatalError(mechTimerOpFailed, strerror(errno)) ;
     }
     /*
-     * Convert the returned time into milliseconds.
+     * Convert the returned time into milliseconds. Truncating the
+     * microseconds makes the timer appear to have run for a fraction of
+     * a millisecond longer than it has. When the timer is stopped
+     * thousands of times a second to post delayed events, those
+     * fractions would add up to delayed events expiring far too soon,
+     * so they are accumulated and given back a millisecond at a time.
      */
+    static unsigned residue ;
     MechDelayTime remain =
             delayedEventTimer.it_value.tv_sec * 1000 +
             delayedEventTimer.it_value.tv_usec / 1000 ;
+    if (remain != 0) {
+        residue += delayedEventTimer.it_value.tv_usec % 1000 ;
+        if (residue >= 1000) {
+            residue -= 1000 ;
+            ++remain ;
+        }
+    }
     /*
      * Set the current timer value to zero to turn it off.
      */
@@ -927,6 +1696,8 @@ mechTimerExpireService(void)
 {
     MechEcb unexpired ;
     MechDelayTime nextTime ;
+
+    ++mechStats.timerExpirations ;
     /*
      * Sync to the background to request the expired events
      * be transferred to the event queue.
@@ -952,6 +1723,11 @@ mechTimerExpireService(void)
          */
         nextTime = 0 ;
     }
+    /*
+     * The timer has run its full time.
+     */
+    delayedQueueClock += delayedQueueTimer ;
+    delayedQueueTimer = nextTime ;
 
     return nextTime ;
 }
@@ -1038,10 +1814,12 @@ traceCreationEvent(
 static void dispatchNormalEvent(MechEcb) ;
 static void dispatchPolyEvent(MechEcb) ;
 static void dispatchCreationEvent(MechEcb) ;
+static void dispatchBroadcastEvent(MechEcb) ;
 static void (* const ecbDispatchFuncs[])(MechEcb) = {
     dispatchNormalEvent,
     dispatchPolyEvent,
     dispatchCreationEvent,
+    dispatchBroadcastEvent,
 } ;
 static void
 mechDispatch(
@@ -1050,10 +1828,10 @@ mechDispatch(
     ecbDispatchFuncs[ecb->eventType](ecb) ;
 }
 static void
-dispatchNormalEvent(
-    MechEcb ecb)
+deliverEvent(
+    MechEcb ecb,
+    MechInstance target)
 {
-    MechInstance target = ecb->instOrClass.targetInst ;
     ObjectDispatchBlock db = target->instClass->odb ;
 
     /*
@@ -1084,7 +1862,7 @@ dispatchNormalEvent(
      * Trace the transition.
      */
     traceNormalEvent(ecb->eventNumber, ecb->srcInst,
-            ecb->instOrClass.targetInst, target->currentState, newState) ;
+            target, target->currentState, newState) ;
 #       endif
     /*
      * Check for a can't happen transition.
@@ -1118,6 +1896,26 @@ dispatchNormalEvent(
             mechInstDestroy(target) ;
         }
     }
+}
+static void
+dispatchNormalEvent(
+    MechEcb ecb)
+{
+    MechInstance target = ecb->instOrClass.targetInst ;
+    if (ecb->ext.periodic.period != 0) {
+        periodicInDispatch = ecb ;
+        deliverEvent(ecb, target) ;
+        periodicInDispatch = NULL ;
+        /*
+         * A periodic event is posted again unless it was canceled or
+         * its target deleted by the dispatch.
+         */
+        if (ecb->ext.periodic.period != 0 && target->alloc == ecb->alloc) {
+            rearmPeriodicEvent(ecb) ;
+        }
+    } else {
+        deliverEvent(ecb, target) ;
+    }
     /*
      * Return the ECB to the pool.
      */
@@ -1154,9 +1952,16 @@ dispatchPolyEvent(
              */
             newEcb->srcInst = ecb->srcInst ;
             /*
-             * Copy event parameters.
+             * Copy event parameters. A payload is shared rather than
+             * copied.
              */
             newEcb->eventParameters = ecb->eventParameters ;
+#           if MECH_PAYLOADPOOLSIZE > 0
+            if (ecb->hasPayload) {
+                mechPayloadRetain(ecb->eventParameters.pparm[0]) ;
+                newEcb->hasPayload = true ;
+            }
+#           endif /* MECH_PAYLOADPOOLSIZE > 0 */
         }
         SubtypeCode type =
                 *(SubtypeCode *)((char *)ecb->instOrClass.targetInst +
@@ -1232,6 +2037,126 @@ dispatchCreationEvent(
 
     dispatchNormalEvent(ecb) ;
 }
+static inline MechInstance
+broadcastInstOfSlot(
+    InstAllocBlock iab,
+    unsigned slot)
+{
+    return (MechInstance)((char *)iab->storageStart +
+            slot * iab->instanceSize) ;
+}
+static inline unsigned
+broadcastSlotOfInst(
+    InstAllocBlock iab,
+    MechInstance inst)
+{
+    return ((char *)inst - (char *)iab->storageStart) / iab->instanceSize ;
+}
+/*
+ * Find the first instance, starting from "inst" and following the list of
+ * allocated instances, to which a broadcast event is to be delivered.
+ */
+static MechInstance
+broadcastTarget(
+    MechEcb ecb,
+    MechInstance inst)
+{
+    while (inst != NULL && ecb->ext.predicate != NULL &&
+            !ecb->ext.predicate(inst)) {
+        inst = mechInstNextAllocated(inst) ;
+    }
+    return inst ;
+}
+static void
+dispatchBroadcastEvent(
+    MechEcb ecb)
+{
+    /*
+     * A broadcast event is delivered to one instance per dispatch. The
+     * targets are taken from the list of allocated instances, starting
+     * when the event reaches the head of the queue, so instances created
+     * or deleted since the event was posted are accounted for. The
+     * predicate is tested again as each target is reached.
+     */
+    InstAllocBlock iab = ecb->instOrClass.targetClass->iab ;
+    MechInstance target ;
+    switch (ecb->pos.cursor) {
+    case BROADCAST_UNSTARTED:
+        target = broadcastTarget(ecb,
+                mechInstFirstAllocated(ecb->instOrClass.targetClass)) ;
+        break ;
+    case BROADCAST_FINISHED:
+        target = NULL ;
+        break ;
+    default:
+        target = broadcastTarget(ecb,
+                broadcastInstOfSlot(iab, ecb->pos.cursor)) ;
+        break ;
+    }
+    if (target == NULL) {
+        broadcastInProgress = NULL ;
+        mechEventDelete(ecb) ;
+        return ;
+    }
+    MechInstance following = broadcastTarget(ecb,
+            mechInstNextAllocated(target)) ;
+    /*
+     * If there are more instances to go, the ECB is returned to the head
+     * of the queue before the action runs. Events the action posts then
+     * fall in the same order as if a separate event had been posted to
+     * each target.
+     */
+    if (following) {
+        ecb->pos.cursor = broadcastSlotOfInst(iab, following) ;
+        eventQueueInsert(ecb, eventQueueBegin(&eventQueue)) ;
+        broadcastInProgress = ecb ;
+    } else {
+        broadcastInProgress = NULL ;
+    }
+    ecb->alloc = target->alloc ;
+    deliverEvent(ecb, target) ;
+    if (following == NULL) {
+        mechEventDelete(ecb) ;
+    }
+}
+/*
+ * Called as an instance is deleted. If the broadcast event in progress is
+ * to be delivered to that instance next, it moves on to the instance that
+ * follows on the allocated list. The ECB is left in the queue even when
+ * no instances follow, since its parameters may still be in use by the
+ * action that is deleting the instance.
+ */
+static void
+broadcastInstDestroyed(
+    MechInstance inst)
+{
+    MechEcb ecb = broadcastInProgress ;
+    InstAllocBlock iab = ecb->instOrClass.targetClass->iab ;
+    if (inst->instClass->iab != iab ||
+            broadcastInstOfSlot(iab, ecb->pos.cursor) != inst) {
+        return ;
+    }
+    MechInstance following = mechInstNextAllocated(inst) ;
+    if (following) {
+        ecb->pos.cursor = broadcastSlotOfInst(iab, following) ;
+    } else {
+        ecb->pos.cursor = BROADCAST_FINISHED ;
+        broadcastInProgress = NULL ;
+    }
+}
+#ifdef MECH_JOURNAL
+void
+mechBroadcastEventResume(
+    MechEcb ecb,
+    uint16_t cursor)
+{
+    assert(ecb->eventType == BroadcastEvent) ;
+    ecb->pos.cursor = cursor ;
+    if (cursor != BROADCAST_UNSTARTED && cursor != BROADCAST_FINISHED) {
+        broadcastInProgress = ecb ;
+    }
+}
+#endif /* MECH_JOURNAL */
 typedef struct fgsyncblock {
     SyncFunc function ;
     SyncParamType params ;
@@ -1412,6 +2337,95 @@ mechRemoveFDService(
         mechMaxFD = fd - 1 ;
     }
 }
+/*
+ * Functions deferred to the end of the run-to-completion step.
+ * A step is the dispatch of one event, the execution of one
+ * synchronization function or the servicing of the ready file descriptors.
+ * Deferring the same function more than once in a step calls it only once.
+ */
+static StepEndFunc stepEndFuncs[MECH_STEPENDSIZE] ;
+static unsigned stepEndCount ;
+
+void
+mechDeferToStepEnd(
+    StepEndFunc func)
+{
+    assert(func != NULL) ;
+    for (unsigned i = 0 ; i < stepEndCount ; i++) {
+        if (stepEndFuncs[i] == func) {
+            return ;
+        }
+    }
+    if (stepEndCount >= MECH_STEPENDSIZE) {
+        mechFatalError(mechStepEndOverflow) ;
+    }
+    stepEndFuncs[stepEndCount++] = func ;
+}
+static inline
+void
+mechEndStep(void)
+{
+    /*
+     * Take the deferred functions as a set so that any function deferred
+     * as they run, including one deferring itself again, is held for the
+     * end of the next step.
+     */
+    unsigned count = stepEndCount ;
+    StepEndFunc funcs[MECH_STEPENDSIZE] ;
+    memcpy(funcs, stepEndFuncs, count * sizeof(funcs[0])) ;
+    stepEndCount = 0 ;
+
+    for (unsigned i = 0 ; i < count ; i++) {
+        funcs[i]() ;
+    }
+}
+MechStats
+mechGetStats(void)
+{
+    return &mechStats ;
+}
+static MechTime
+sysClockNow(void)
+{
+    struct timespec now ;
+    clock_gettime(CLOCK_MONOTONIC, &now) ;
+    return (MechTime)now.tv_sec * 1000000 + now.tv_nsec / 1000 ;
+}
+static MechTimeSource timeSource = sysClockNow ;
+static MechTime stepTime ;
+static MechTime epochOffset ;
+static inline
+void
+mechBeginStep(void)
+{
+    stepTime = timeSource() ;
+}
+MechTime
+mechNow(void)
+{
+    return stepTime ;
+}
+MechTime
+mechNowEpoch(void)
+{
+    return stepTime + epochOffset ;
+}
+MechTimeSource
+mechSetTimeSource(
+    MechTimeSource source)
+{
+    MechTimeSource prevSource = timeSource ;
+    timeSource = source ? source : sysClockNow ;
+    mechBeginStep() ;
+    /*
+     * Relate the new clock to the time of day.
+     */
+    struct timespec now ;
+    clock_gettime(CLOCK_REALTIME, &now) ;
+    epochOffset = (MechTime)now.tv_sec * 1000000 + now.tv_nsec / 1000 -
+            stepTime ;
+    return prevSource ;
+}
 static void
 fdServiceInit(void)
 {
@@ -1423,6 +2437,13 @@ MECH_TEST_STATIC
 void
 mechWait(void)
 {
+#   ifdef MECH_JOURNAL
+    /*
+     * Going idle is the natural point to commit the journal records
+     * accumulated since the last wait.
+     */
+    mechJournalCommit() ;
+#   endif /* MECH_JOURNAL */
     beginCriticalSection() ;
     if (syncQueueEmpty()) {
         /*
@@ -1465,6 +2486,7 @@ mechWait(void)
              * Dispatch the service functions for the file
              * descriptors.
              */
+            mechBeginStep() ;
             FDServiceMap s = mechFDServicePool ;
             for (int fd = 0 ; r > 0 && fd <= mechMaxFD ;
                     ++fd, ++s) {
@@ -1490,6 +2512,7 @@ mechWait(void)
                     --r ;
                 }
             }
+            mechEndStep() ;
         }
     }
     endCriticalSection() ;
@@ -1505,6 +2528,7 @@ void
 mechInit(void)
 {
     sysPlatformInit() ;
+    mechSetTimeSource(sysClockNow) ;
     mechEventInit() ;
     initCriticalSection() ;
     sysTimerInit() ;
@@ -1519,7 +2543,9 @@ mechInvokeOneSyncFunc(void)
     bool didOne ;
     FgSyncBlock blk = syncQueueGet() ;
     if (blk && blk->function) {
+        mechBeginStep() ;
         blk->function(&blk->params) ;
+        mechEndStep() ;
         didOne = true ;
     } else {
         didOne = false ;
@@ -1533,12 +2559,30 @@ mechDispatchOneEvent(void)
 {
     bool didOne = !eventQueueEmpty(&eventQueue) ;
     if (didOne) {
-        MechEcb ecb = eventQueue.next ;
+        MechEcb ecb = eventQueueBegin(&eventQueue) ;
         eventQueueRemove(ecb) ;
+        instEventIndexRemove(ecb) ;
+        mechBeginStep() ;
+#       ifdef MECH_JOURNAL
+        mechInDispatch = true ;
+        mechDispatch(ecb) ;
+        mechInDispatch = false ;
+        mechJournalDispatched() ;
+#       else
         mechDispatch(ecb) ;
+#       endif /* MECH_JOURNAL */
+        ++mechStats.eventsDispatched ;
+        mechEndStep() ;
     }
     return didOne ;
 }
+#ifdef MECH_JOURNAL
+bool
+mechEventDispatchNext(void)
+{
+    return mechDispatchOneEvent() ;
+}
+#endif /* MECH_JOURNAL */
 #ifdef MECH_TEST
 void
 stsa_main(void)
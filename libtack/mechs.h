@@ -72,20 +72,43 @@
 #ifndef MECH_EVENTPOOLSIZE
 #   define MECH_EVENTPOOLSIZE 10
 #endif /* MECH_EVENTPOOLSIZE */
+#ifndef MECH_DELAYINDEXSIZE
+#   define MECH_DELAYINDEXSIZE MECH_EVENTPOOLSIZE
+#endif /* MECH_DELAYINDEXSIZE */
+#ifndef MECH_INSTEVENTINDEXSIZE
+#   define MECH_INSTEVENTINDEXSIZE MECH_EVENTPOOLSIZE
+#endif /* MECH_INSTEVENTINDEXSIZE */
 #define MECH_DISPATCH_CREATION_STATE    0
 #ifndef MECH_SYNCQUEUESIZE
 #   define MECH_SYNCQUEUESIZE 10
 #endif /* MECH_SYNCQUEUESIZE */
+#ifndef MECH_STEPENDSIZE
+#   define MECH_STEPENDSIZE 4
+#endif /* MECH_STEPENDSIZE */
+/*
+ * Event parameters too large for an ECB may be placed in a payload
+ * block taken from a pool of MECH_PAYLOADPOOLSIZE blocks of
+ * MECH_PAYLOAD_SIZE bytes each. With a pool size of zero, the default,
+ * there are no payloads.
+ */
+#ifndef MECH_PAYLOADPOOLSIZE
+#   define MECH_PAYLOADPOOLSIZE 0
+#endif /* MECH_PAYLOADPOOLSIZE */
+#ifndef MECH_PAYLOAD_SIZE
+#   define MECH_PAYLOAD_SIZE 128
+#endif /* MECH_PAYLOAD_SIZE */
 typedef uint8_t AllocCount ;
 typedef uint8_t StateCode ;
 typedef enum {
     NormalEvent,
     PolymorphicEvent,
-    CreationEvent
+    CreationEvent,
+    BroadcastEvent
 } MechEventType ;
 typedef uint8_t RefCount ;
 typedef uint8_t EventCode ;
 typedef unsigned long int MechDelayTime ;
+typedef uint64_t MechTime ;
 typedef uint8_t DispatchCount ;
 typedef void ActionFunction(void *const, void *const) ;
 typedef ActionFunction *PtrActionFunction ;
@@ -101,6 +124,8 @@ typedef enum {
     mechNoECB,
     mechNoInstSlot,
     mechSyncOverflow,
+    mechStepEndOverflow,
+    mechNoPayload,
     #ifdef __unix__
     mechTimerOpFailed,
     mechSignalOpFailed,
@@ -111,8 +136,11 @@ typedef struct mechinstance {
     AllocCount alloc ;
     StateCode currentState ;
     struct mechclass const *instClass ;
+    struct mechinstance *nextAlloc ;
+    struct mechinstance *prevAlloc ;
 } *MechInstance ;
 typedef void (*InstCtor)(MechInstance) ;
+typedef bool (*MechInstPredicate)(MechInstance) ;
 typedef void (*InstDtor)(MechInstance) ;
 typedef struct installocblock {
     void *storageStart ;
@@ -122,6 +150,8 @@ typedef struct installocblock {
     size_t instanceSize ;
     InstCtor construct ;
     InstDtor destruct ;
+    MechInstance firstAlloc ;
+    bool allocListed ;
 } *InstAllocBlock ;
 typedef union {
     signed char cparm[MECH_ECB_PARAM_SIZE] ;
@@ -168,19 +198,59 @@ typedef EventParamType SyncParamType ;
 typedef SyncParamType *SyncParamRef ;
 typedef void (*SyncFunc)(SyncParamRef) ;
 typedef void (*FDServiceFunc)(int) ;
+/*
+ * With MECH_ECB_COMPACT defined, ECBs are linked by their 16-bit index in
+ * the pool, plus one so that zero is the null link, and delay times are held
+ * in 32 bits. An ECB together with its parameters then fits in 64 bytes,
+ * a single cache line on most processors.
+ */
+#ifdef MECH_ECB_COMPACT
+typedef uint16_t MechEcbLink ;
+typedef uint32_t MechEcbDelay ;
+typedef uint32_t MechEcbTime ;
+typedef uint8_t MechEcbType ;
+#else
+typedef struct mechecb *MechEcbLink ;
+typedef MechDelayTime MechEcbDelay ;
+typedef MechTime MechEcbTime ;
+typedef MechEventType MechEcbType ;
+#endif /* MECH_ECB_COMPACT */
+#define MECH_ECB_NOLINK ((MechEcbLink)0)
 typedef struct mechecb {
-    struct mechecb *next ;
-    struct mechecb *prev ;
+    MechEcbLink next ;
+    MechEcbLink prev ;
+    MechEcbLink delayLink ;
+    MechEcbLink instLink ;
     RefCount referenceCount ;
     EventCode eventNumber ;
     AllocCount alloc ;
-    MechEventType eventType ;
+    bool delayed : 1 ;
+    bool suspended : 1 ;
+    bool hasPayload : 1 ;
+    MechEcbType eventType ;
+    /*
+     * Events that target an instance are linked back to their predecessor
+     * in the instance event index. Broadcast events, which are not
+     * indexed, instead hold the slot at which delivery resumes.
+     */
+    union {
+        MechEcbLink instPrev ;
+        uint16_t cursor ;
+    } pos ;
     union {
         MechInstance targetInst ;
         MechClass targetClass ;
     } instOrClass ;
     MechInstance srcInst ;
-    MechDelayTime delay ;
+    MechEcbDelay delay ;
+    MechEcbDelay expire ;
+    union {
+        MechInstPredicate predicate ;
+        struct {
+            MechEcbDelay period ;
+            MechEcbTime deadline ;
+        } periodic ;
+    } ext ;
     EventParamType eventParameters ;
 } *MechEcb ;
 extern MechInstance mechInstCreate(
@@ -202,6 +272,36 @@ mechCreationEventNew(
     EventCode event,
     MechClass targetClass,
     MechInstance srcInst) ;
+/*
+ * A broadcast event is delivered to each allocated instance of the
+ * target class for which the predicate is true, or to all of them if the
+ * predicate is NULL. Only one ECB is used, whatever the number of
+ * targets, and the targets are found as the event is dispatched.
+ */
+extern MechEcb
+mechBroadcastEventNew(
+    EventCode event,
+    MechClass targetClass,
+    MechInstPredicate predicate,
+    MechInstance srcInst) ;
+#if MECH_PAYLOADPOOLSIZE > 0
+/*
+ * A payload is a reference counted block of MECH_PAYLOAD_SIZE bytes.
+ * "mechPayloadAlloc" returns a block holding one reference for the caller.
+ * Attaching a payload to an ECB hands that reference over to the event
+ * and places the payload address as the first pointer in the event
+ * parameters, where the event declares it as its first parameter. The
+ * reference is released when the ECB is returned to the pool. An action
+ * that keeps the payload past the end of its dispatch must retain it.
+ */
+extern void *mechPayloadAlloc(void) ;
+extern void mechPayloadRetain(void *payload) ;
+extern void mechPayloadRelease(void *payload) ;
+extern void
+mechEventAttachPayload(
+    MechEcb ecb,
+    void *payload) ;
+#endif /* MECH_PAYLOADPOOLSIZE > 0 */
 extern void mechEventPost(MechEcb ecb) ;
 extern void mechEventPostSelf(MechEcb ecb) ;
 extern void
@@ -218,6 +318,47 @@ mechEventDelayRemaining(
     EventCode event,
     MechInstance targetInst,
     MechInstance srcInst) ;
+/*
+ * Suspend a delayed event, holding it aside with its remaining time.
+ * Returns the remaining time or 0 if the event is not delayed.
+ */
+extern MechDelayTime
+mechEventDelaySuspend(
+    EventCode event,
+    MechInstance targetInst,
+    MechInstance srcInst) ;
+/*
+ * Resume the timing of a suspended event for its remaining time.
+ * Returns false if the event is not suspended.
+ */
+extern bool
+mechEventDelayResume(
+    EventCode event,
+    MechInstance targetInst,
+    MechInstance srcInst) ;
+/*
+ * Cancel every event, queued, delayed or suspended, whose target is
+ * "targetInst". Destroying an instance does this for it.
+ */
+extern void
+mechEventCancelAllFor(
+    MechInstance targetInst) ;
+/*
+ * Post an event that recurs every "period" milliseconds until it is
+ * canceled. The one ECB is posted again after each dispatch, timed from
+ * the deadline it was due rather than from when it ran. Periods that
+ * pass entirely while dispatch is behind are skipped and counted in the
+ * "periodsMissed" statistic.
+ */
+extern void
+mechEventPostPeriodic(
+    MechEcb ecb,
+    MechDelayTime period) ;
+extern void
+mechEventPeriodicCancel(
+    EventCode event,
+    MechInstance targetInst,
+    MechInstance srcInst) ;
 /*
  * Must be invoked from interrupt service level only!
  */
@@ -228,8 +369,67 @@ extern bool mechEventAvail(void) ;
 extern bool
 mechInstAvail(
     MechClass instClass) ;
+/*
+ * Iterate over the allocated instances of a class, most recently created
+ * first, in time proportional to the number of allocated instances rather
+ * than the number of storage slots. An instance deleted during the
+ * iteration must not be the one passed to "mechInstNextAllocated".
+ * If the storage of a class is rewritten, e.g. when it is restored from
+ * a checkpoint, "mechInstRelistAllocated" must be called before the
+ * class is used again. The list is held in the storage, apart from its
+ * first instance, so an image of the storage keeps the order of the list
+ * if the first instance is saved with it. "mechInstRestoreAllocated"
+ * then puts it back when the image is restored, a NULL first instance
+ * listing the class again.
+ */
+extern MechInstance
+mechInstFirstAllocated(
+    MechClass instClass) ;
+extern MechInstance
+mechInstNextAllocated(
+    MechInstance inst) ;
+extern void
+mechInstRelistAllocated(
+    MechClass instClass) ;
+extern void
+mechInstRestoreAllocated(
+    MechClass instClass,
+    MechInstance first) ;
 extern SyncParamRef mechSyncRequest(SyncFunc) ;
 extern SyncParamRef mechTrySyncRequest(SyncFunc) ;
+/*
+ * Request that a function be called once at the end of the current
+ * run-to-completion step, i.e. after the dispatch of the current event,
+ * synchronization function or I/O service has finished.
+ * A function deferred while the step end functions are running is
+ * called at the end of the following step.
+ */
+typedef void (*StepEndFunc)(void) ;
+extern void mechDeferToStepEnd(StepEndFunc) ;
+/*
+ * Running counts of the work done by the mechanisms, used to gauge the
+ * event and timer load on a system.
+ */
+typedef struct mechstats {
+    unsigned long eventsDispatched ;
+    unsigned long delayedPosted ;
+    unsigned long timerExpirations ;
+    unsigned long periodsMissed ;
+    unsigned ecbInUse ;
+    unsigned ecbMaxInUse ;
+} const *MechStats ;
+extern MechStats mechGetStats(void) ;
+/*
+ * The current time, in microseconds, from a monotonic clock.
+ * The clock is read once at the beginning of each run-to-completion step
+ * and every call to "mechNow" during the step returns that same time.
+ * "mechNowEpoch" returns the same instant as the time since the Epoch.
+ * The clock may be replaced, e.g. by a virtual clock for testing.
+ */
+typedef MechTime (*MechTimeSource)(void) ;
+extern MechTime mechNow(void) ;
+extern MechTime mechNowEpoch(void) ;
+extern MechTimeSource mechSetTimeSource(MechTimeSource) ;
 extern void sysDeviceInit(void) ;
 extern void sysDomainInit(void) ;
 #ifdef MECH_SM_TRACE
@@ -257,6 +457,34 @@ typedef struct mechtraceinfo {
 typedef void (*MechTraceCallback)(MechTraceInfo) ;
 extern MechTraceCallback mechRegisterTrace(MechTraceCallback) ;
 #endif  /* MECH_SM_TRACE */
+#ifdef MECH_JOURNAL
+/*
+ * Used by the event journal to save and restore the pending events and
+ * to dispatch events while replaying the journal. The time passed for a
+ * delayed event is that remaining until it expires, which for a periodic
+ * event is its next deadline. The period is held in the ECB.
+ */
+typedef void (*MechPendingFunc)(MechEcb, MechDelayTime, void *) ;
+extern void mechEventForEachPending(MechPendingFunc func, void *arg) ;
+/*
+ * Place an event directly among the suspended events with "remain"
+ * milliseconds left to run, as it was when its state was saved.
+ */
+extern void
+mechEventPostSuspended(
+    MechEcb ecb,
+    MechDelayTime remain) ;
+extern void mechEventPurgeAll(void) ;
+extern bool mechEventDispatchNext(void) ;
+/*
+ * Set where delivery of a broadcast event resumes, as it was when its
+ * state was saved.
+ */
+extern void
+mechBroadcastEventResume(
+    MechEcb ecb,
+    uint16_t cursor) ;
+#endif  /* MECH_JOURNAL */
 typedef void (*SignalFunc)(int) ;
 extern void
 mechRegisterSignal(
@@ -312,6 +540,17 @@ mechEventGenerateCreation(
 }
 static inline 
 void
+mechEventBroadcast(
+    EventCode event,
+    MechClass targetClass,
+    MechInstPredicate predicate,
+    MechInstance source)
+{
+    mechEventPost(mechBroadcastEventNew(event, targetClass, predicate,
+            source)) ;
+}
+static inline 
+void
 mechEventGenerateDelayed(
     EventCode event,
     MechInstance target,
@@ -331,6 +570,16 @@ mechEventGenerateDelayedToSelf(
     mechEventPostDelay(mechEventNew(event, target, target),
             delay) ;
 }
+static inline 
+void
+mechEventGeneratePeriodicToSelf(
+    EventCode event,
+    MechInstance target,
+    MechDelayTime period)
+{
+    mechEventPostPeriodic(mechEventNew(event, target, target),
+            period) ;
+}
 #ifdef MECH_TEST
 extern void stsa_main(void) ;
 extern void mechInit(void) ;
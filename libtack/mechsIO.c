@@ -249,6 +249,49 @@ mechOutput(
     return n ;
 }
 
+ssize_t
+mechOutputAll(
+    int fd,
+    void const *msg,
+    size_t len)
+{
+    char const *place = msg ;
+    size_t remain = len ;
+
+    while (remain != 0) {
+#       ifdef __linux
+        ssize_t n = send(fd, place, remain, MSG_NOSIGNAL) ;
+#       else
+        ssize_t n = send(fd, place, remain, 0) ;
+#       endif  /* __linux */
+        if (n == -1) {
+            if (errno == EINTR) {
+                continue ;
+            } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                /*
+                 * Socket buffer is full. Wait until the other end drains
+                 * some of it.
+                 */
+                fd_set writefds ;
+                FD_ZERO(&writefds) ;
+                FD_SET(fd, &writefds) ;
+                if (select(fd + 1, NULL, &writefds, NULL, NULL) == -1 &&
+                        errno != EINTR) {
+                    perror("select()") ;
+                    return -1 ;
+                }
+                continue ;
+            }
+            perror("send()") ;
+            return -1 ;
+        }
+        place += n ;
+        remain -= n ;
+    }
+
+    return len ;
+}
+
 /*======================================================================*/
 
 static void
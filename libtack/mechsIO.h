@@ -129,4 +129,19 @@ mechOutput(
     bool final
 ) ;
 
+/*
+ * Output the entire message to a file descriptor. The descriptors used for
+ * input are non-blocking and large messages may not fit in the available
+ * socket buffer space. This function waits for the descriptor to become
+ * writable until all the message has been sent.
+ */
+extern
+ssize_t                     /* Returns the number of bytes sent or -1 on
+                             * error. */
+mechOutputAll(
+    int fd,                 /* file descriptor to write to */
+    void const *msg,        /* pointer to the message bytes */
+    size_t len              /* number of bytes in the message */
+) ;
+
 #endif /* _MECHS_IO_H_ */
@@ -0,0 +1,315 @@
+/*
+ * This software is copyrighted 2008 -2013 by G. Andrew Mangogna.  The following
+ * terms apply to all files associated with the software unless explicitly
+ * disclaimed in individual files.
+ * 
+ * The author hereby grants permission to use, copy, modify, distribute,
+ * and license this software and its documentation for any purpose, provided
+ * that existing copyright notices are retained in all copies and that this
+ * notice is included verbatim in any distributions. No written agreement,
+ * license, or royalty fee is required for any of the authorized uses.
+ * Modifications to this software may be copyrighted by their authors and
+ * need not follow the licensing terms described here, provided that the
+ * new terms are clearly indicated on the first page of each file where
+ * they apply.
+ * 
+ * IN NO EVENT SHALL THE AUTHORS OR DISTRIBUTORS BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES ARISING
+ * OUT OF THE USE OF THIS SOFTWARE, ITS DOCUMENTATION, OR ANY DERIVATIVES
+ * THEREOF, EVEN IF THE AUTHORS HAVE BEEN ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * 
+ * THE AUTHORS AND DISTRIBUTORS SPECIFICALLY DISCLAIM ANY WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.  THIS SOFTWARE
+ * IS PROVIDED ON AN "AS IS" BASIS, AND THE AUTHORS AND DISTRIBUTORS HAVE
+ * NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS,
+ * OR MODIFICATIONS.
+ * 
+ * GOVERNMENT USE: If you are acquiring this software on behalf of the
+ * U.S. government, the Government shall have only "Restricted Rights"
+ * in the software and related documentation as defined in the Federal
+ * Acquisition Regulations (FARs) in Clause 52.227.19 (c) (2).  If you
+ * are acquiring the software on behalf of the Department of Defense,
+ * the software shall be classified as "Commercial Computer Software"
+ * and the Government shall have only "Restricted Rights" as defined in
+ * Clause 252.227-7013 (c) (1) of DFARs.  Notwithstanding the foregoing,
+ * the authors grant the U.S. Government and others acting in its behalf
+ * permission to use and distribute the software in accordance with the
+ * terms specified in this license.
+ *
+ * *++
+ * MODULE:
+ *  mechsIndex.c -- implementation of identifier indexes
+ * ABSTRACT:
+ *  Open addressing hash tables, using linear probing, that map the value of
+ *  an identifying attribute to the instance that holds it.
+ *
+ **--
+ */
+
+#include "mechsIndex.h"
+
+#include <assert.h>
+#include <string.h>
+
+static unsigned indexHash(MechIndex, void const *) ;
+static bool indexKeyMatch(MechIndex, void const *, void const *) ;
+static void const *indexInstKey(MechIndex, void const *) ;
+static void const *indexSlotInst(MechIndex, MechIndexSlot) ;
+static MechIndexSlot indexInstSlot(MechIndex, void const *) ;
+static bool indexCovers(MechIndex, void const *) ;
+
+/*
+ * Chain of indexes that are maintained when instances are destroyed or
+ * updated through the data portal.
+ */
+static MechIndex registeredIndexes ;
+
+void
+mechIndexInit(
+    MechIndex index)
+{
+    assert(index != NULL) ;
+    assert(index->buckets != NULL) ;
+    assert(index->bucketCount > index->instanceCount) ;
+    assert(index->instanceCount < UINT16_MAX) ;
+
+    if (!index->registered) {
+        index->nextIndex = registeredIndexes ;
+        registeredIndexes = index ;
+        index->registered = true ;
+    }
+
+    memset(index->buckets, 0, index->bucketCount * sizeof(MechIndexSlot)) ;
+    char const *inst = index->storageStart ;
+    for (unsigned slot = 0 ; slot < index->instanceCount ;
+            ++slot, inst += index->instanceSize) {
+        if (!index->hasCommon || ((MechInstance)inst)->alloc != 0) {
+            mechIndexInsert(index, inst) ;
+        }
+    }
+}
+
+void
+mechIndexInsert(
+    MechIndex index,
+    void const *inst)
+{
+    void const *key = indexInstKey(index, inst) ;
+    if (key == NULL) {
+        return ;
+    }
+    MechIndexSlot slot = indexInstSlot(index, inst) ;
+    unsigned b = indexHash(index, key) ;
+    /*
+     * The table is never full, so there is always an empty bucket to stop
+     * the probe.
+     */
+    while (index->buckets[b] != 0) {
+        if (index->buckets[b] == slot) {
+            return ;
+        }
+        b = b + 1 == index->bucketCount ? 0 : b + 1 ;
+    }
+    index->buckets[b] = slot ;
+}
+
+void
+mechIndexRemove(
+    MechIndex index,
+    void const *inst)
+{
+    void const *key = indexInstKey(index, inst) ;
+    if (key == NULL) {
+        return ;
+    }
+    MechIndexSlot slot = indexInstSlot(index, inst) ;
+    unsigned b = indexHash(index, key) ;
+    while (index->buckets[b] != slot) {
+        if (index->buckets[b] == 0) {
+            return ;
+        }
+        b = b + 1 == index->bucketCount ? 0 : b + 1 ;
+    }
+    /*
+     * Close the gap by shifting back any following entries whose probe
+     * sequence passes through the vacated bucket.
+     */
+    unsigned hole = b ;
+    index->buckets[hole] = 0 ;
+    for (unsigned next = hole + 1 == index->bucketCount ? 0 : hole + 1 ;
+            index->buckets[next] != 0 ;
+            next = next + 1 == index->bucketCount ? 0 : next + 1) {
+        unsigned home = indexHash(index,
+                indexInstKey(index, indexSlotInst(index, index->buckets[next]))) ;
+        bool reachable = hole <= next ?
+                (home <= hole || home > next) :
+                (home <= hole && home > next) ;
+        if (reachable) {
+            index->buckets[hole] = index->buckets[next] ;
+            index->buckets[next] = 0 ;
+            hole = next ;
+        }
+    }
+}
+
+void *
+mechIndexFind(
+    MechIndex index,
+    void const *key)
+{
+    if (key == NULL) {
+        return NULL ;
+    }
+    for (unsigned b = indexHash(index, key) ; index->buckets[b] != 0 ;
+            b = b + 1 == index->bucketCount ? 0 : b + 1) {
+        void const *inst = indexSlotInst(index, index->buckets[b]) ;
+        if (indexKeyMatch(index, indexInstKey(index, inst), key)) {
+            return (void *)inst ;
+        }
+    }
+    return NULL ;
+}
+
+void
+mechIndexDetachInst(
+    void const *inst)
+{
+    for (MechIndex index = registeredIndexes ; index != NULL ;
+            index = index->nextIndex) {
+        if (indexCovers(index, inst)) {
+            mechIndexRemove(index, inst) ;
+        }
+    }
+}
+
+void
+mechIndexAttrUpdate(
+    void const *attr,
+    bool updating)
+{
+    for (MechIndex index = registeredIndexes ; index != NULL ;
+            index = index->nextIndex) {
+        if (indexCovers(index, attr)) {
+            size_t offset = ((char const *)attr -
+                    (char const *)index->storageStart) % index->instanceSize ;
+            if (offset == index->keyOffset) {
+                void const *inst = (char const *)attr - offset ;
+                if (updating) {
+                    mechIndexRemove(index, inst) ;
+                } else {
+                    mechIndexInsert(index, inst) ;
+                }
+            }
+        }
+    }
+}
+
+void
+mechIndexRebuildAll(void)
+{
+    for (MechIndex index = registeredIndexes ; index != NULL ;
+            index = index->nextIndex) {
+        mechIndexInit(index) ;
+    }
+}
+
+/*
+ * FNV-1a hash of the key reduced to a bucket number.
+ */
+static unsigned
+indexHash(
+    MechIndex index,
+    void const *key)
+{
+    uint32_t hash = 2166136261u ;
+    unsigned char const *k = key ;
+
+    switch (index->keyType) {
+    case MechKeyStringRef:
+        for ( ; *k != '\0' ; ++k) {
+            hash = (hash ^ *k) * 16777619u ;
+        }
+        break ;
+    case MechKeyStringArray:
+        for (size_t n = 0 ; n < index->keySize && k[n] != '\0' ; ++n) {
+            hash = (hash ^ k[n]) * 16777619u ;
+        }
+        break ;
+    case MechKeyValue:
+        for (size_t n = 0 ; n < index->keySize ; ++n) {
+            hash = (hash ^ k[n]) * 16777619u ;
+        }
+        break ;
+    }
+    return hash % index->bucketCount ;
+}
+
+static bool
+indexKeyMatch(
+    MechIndex index,
+    void const *instKey,
+    void const *key)
+{
+    switch (index->keyType) {
+    case MechKeyStringRef:
+        return strcmp(instKey, key) == 0 ;
+    case MechKeyStringArray:
+        return strncmp(instKey, key, index->keySize) == 0 &&
+            (strlen(key) <= index->keySize) ;
+    case MechKeyValue:
+        return memcmp(instKey, key, index->keySize) == 0 ;
+    }
+    return false ;
+}
+
+/*
+ * Returns a pointer to the key value of an instance in the form expected by
+ * "indexHash" and "indexKeyMatch". For string references, this is the string
+ * itself, which may be NULL if the attribute has not been set.
+ */
+static void const *
+indexInstKey(
+    MechIndex index,
+    void const *inst)
+{
+    void const *attr = (char const *)inst + index->keyOffset ;
+    if (index->keyType == MechKeyStringRef) {
+        char const *str ;
+        memcpy(&str, attr, sizeof(str)) ;
+        return str ;
+    }
+    return attr ;
+}
+
+static void const *
+indexSlotInst(
+    MechIndex index,
+    MechIndexSlot slot)
+{
+    assert(slot != 0 && slot <= index->instanceCount) ;
+    return (char const *)index->storageStart +
+            (slot - 1) * index->instanceSize ;
+}
+
+static MechIndexSlot
+indexInstSlot(
+    MechIndex index,
+    void const *inst)
+{
+    assert(indexCovers(index, inst)) ;
+    return (MechIndexSlot)(((char const *)inst -
+            (char const *)index->storageStart) / index->instanceSize + 1) ;
+}
+
+static bool
+indexCovers(
+    MechIndex index,
+    void const *addr)
+{
+    char const *start = index->storageStart ;
+    return (char const *)addr >= start &&
+            (char const *)addr < start +
+                index->instanceCount * index->instanceSize ;
+}
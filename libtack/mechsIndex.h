@@ -0,0 +1,180 @@
+/*
+ * This software is copyrighted 2008 by G. Andrew Mangogna.  The following
+ * terms apply to all files associated with the software unless explicitly
+ * disclaimed in individual files.
+ * 
+ * The author hereby grants permission to use, copy, modify, distribute,
+ * and license this software and its documentation for any purpose, provided
+ * that existing copyright notices are retained in all copies and that this
+ * notice is included verbatim in any distributions. No written agreement,
+ * license, or royalty fee is required for any of the authorized uses.
+ * Modifications to this software may be copyrighted by their authors and
+ * need not follow the licensing terms described here, provided that the
+ * new terms are clearly indicated on the first page of each file where
+ * they apply.
+ * 
+ * IN NO EVENT SHALL THE AUTHORS OR DISTRIBUTORS BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES ARISING
+ * OUT OF THE USE OF THIS SOFTWARE, ITS DOCUMENTATION, OR ANY DERIVATIVES
+ * THEREOF, EVEN IF THE AUTHORS HAVE BEEN ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * 
+ * THE AUTHORS AND DISTRIBUTORS SPECIFICALLY DISCLAIM ANY WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.  THIS SOFTWARE
+ * IS PROVIDED ON AN "AS IS" BASIS, AND THE AUTHORS AND DISTRIBUTORS HAVE
+ * NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS,
+ * OR MODIFICATIONS.
+ * 
+ * GOVERNMENT USE: If you are acquiring this software on behalf of the
+ * U.S. government, the Government shall have only "Restricted Rights"
+ * in the software and related documentation as defined in the Federal
+ * Acquisition Regulations (FARs) in Clause 52.227.19 (c) (2).  If you
+ * are acquiring the software on behalf of the Department of Defense,
+ * the software shall be classified as "Commercial Computer Software"
+ * and the Government shall have only "Restricted Rights" as defined in
+ * Clause 252.227-7013 (c) (1) of DFARs.  Notwithstanding the foregoing,
+ * the authors grant the U.S. Government and others acting in its behalf
+ * permission to use and distribute the software in accordance with the
+ * terms specified in this license.
+ *
+ * *++
+ * MODULE:
+ *  mechsIndex.h -- interface to identifier indexes
+ * ABSTRACT:
+ *  Hash indexes that find a class instance from the value of an
+ *  identifying attribute.
+ **--
+ */
+
+#ifndef _MECHS_INDEX_H_
+#define _MECHS_INDEX_H_
+
+#include "mechs.h"
+
+/*
+ * Number of buckets to allocate for an index of a class with "n" instance
+ * slots. Keeping the table at most half full keeps the probe sequences short.
+ */
+#define MECH_INDEX_BUCKETS(n)   (2 * (n) + 1)
+
+/*
+ * A bucket holds the instance slot number plus one. Zero marks an empty
+ * bucket.
+ */
+typedef uint16_t MechIndexSlot ;
+
+/*
+ * How the identifying attribute is held in the instance.
+ */
+typedef enum {
+    MechKeyStringRef,       /* "char const *" to a NUL terminated string */
+    MechKeyStringArray,     /* array of "keySize" characters, NUL terminated
+                             * if shorter than the array */
+    MechKeyValue            /* "keySize" bytes compared as is */
+} MechIndexKeyType ;
+
+/*
+ * An index over the storage pool of a class. The fields up to "buckets" are
+ * set by the domain before calling "mechIndexInit". The remaining ones are
+ * maintained by the index functions.
+ */
+typedef struct mechindex {
+    void const *storageStart ;      /* first element of class storage */
+    size_t instanceSize ;           /* size of a class instance */
+    unsigned instanceCount ;        /* number of instance slots */
+    size_t keyOffset ;              /* offset of the key attribute */
+    size_t keySize ;                /* size of the key for "MechKeyStringArray"
+                                     * and "MechKeyValue" types */
+    MechIndexKeyType keyType ;      /* interpretation of the key attribute */
+    bool hasCommon ;                /* instances begin with a "mechinstance"
+                                     * and unallocated slots are skipped */
+    MechIndexSlot *buckets ;        /* hash table storage */
+    unsigned bucketCount ;          /* number of elements in "buckets" */
+    struct mechindex *nextIndex ;   /* chain of registered indexes */
+    bool registered ;               /* index is on the registered chain */
+} *MechIndex ;
+
+/*
+ * Initialize an index, register it to be maintained when instances are
+ * destroyed or their key attribute is updated via the data portal and
+ * insert all the existing instances. Domains usually call this from their
+ * "init" domain operation as part of "sysDomainInit".
+ */
+extern
+void
+mechIndexInit(
+    MechIndex index         /* pointer to the index with its descriptive
+                             * fields filled in */
+) ;
+
+/*
+ * Insert an instance into the index. Instances are not inserted when they
+ * are created since their attribute values have not yet been set. Actions
+ * that create an instance must insert it after assigning the key attribute.
+ */
+extern
+void
+mechIndexInsert(
+    MechIndex index,        /* pointer to the index */
+    void const *inst        /* pointer to the instance to insert */
+) ;
+
+/*
+ * Remove an instance from the index. This must be done before changing the
+ * value of the key attribute in an action. Instances are removed
+ * automatically when they are destroyed.
+ */
+extern
+void
+mechIndexRemove(
+    MechIndex index,        /* pointer to the index */
+    void const *inst        /* pointer to the instance to remove */
+) ;
+
+/*
+ * Find the instance whose key attribute matches a value.
+ */
+extern
+void *                      /* Returns a pointer to the matching instance or
+                             * NULL if there is none. */
+mechIndexFind(
+    MechIndex index,        /* pointer to the index */
+    void const *key         /* For string keys, a pointer to the NUL
+                             * terminated string to find. For "MechKeyValue"
+                             * keys, a pointer to the value to find. */
+) ;
+
+/*
+ * Remove an instance from all the registered indexes that cover it.
+ * Invoked by "mechInstDestroy".
+ */
+extern
+void
+mechIndexDetachInst(
+    void const *inst        /* pointer to the instance being destroyed */
+) ;
+
+/*
+ * Inform the registered indexes that an attribute value is about to change
+ * ("updating" is true) or has just changed ("updating" is false). Indexes
+ * keyed by the attribute remove the instance before the change and insert
+ * it again afterwards. Invoked by the data portal when updating attributes.
+ */
+extern
+void
+mechIndexAttrUpdate(
+    void const *attr,       /* address of the attribute in its instance */
+    bool updating           /* true before the change, false after it */
+) ;
+
+/*
+ * Rebuild all the registered indexes from the instances now in class
+ * storage. Invoked by the event journal after restoring a checkpoint,
+ * which replaces the storage without going through the index functions.
+ */
+extern
+void
+mechIndexRebuildAll(void) ;
+
+#endif /* _MECHS_INDEX_H_ */
@@ -0,0 +1,985 @@
+/*
+ * This software is copyrighted 2008 -2013 by G. Andrew Mangogna.  The following
+ * terms apply to all files associated with the software unless explicitly
+ * disclaimed in individual files.
+ * 
+ * The author hereby grants permission to use, copy, modify, distribute,
+ * and license this software and its documentation for any purpose, provided
+ * that existing copyright notices are retained in all copies and that this
+ * notice is included verbatim in any distributions. No written agreement,
+ * license, or royalty fee is required for any of the authorized uses.
+ * Modifications to this software may be copyrighted by their authors and
+ * need not follow the licensing terms described here, provided that the
+ * new terms are clearly indicated on the first page of each file where
+ * they apply.
+ * 
+ * IN NO EVENT SHALL THE AUTHORS OR DISTRIBUTORS BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES ARISING
+ * OUT OF THE USE OF THIS SOFTWARE, ITS DOCUMENTATION, OR ANY DERIVATIVES
+ * THEREOF, EVEN IF THE AUTHORS HAVE BEEN ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * 
+ * THE AUTHORS AND DISTRIBUTORS SPECIFICALLY DISCLAIM ANY WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.  THIS SOFTWARE
+ * IS PROVIDED ON AN "AS IS" BASIS, AND THE AUTHORS AND DISTRIBUTORS HAVE
+ * NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS,
+ * OR MODIFICATIONS.
+ * 
+ * GOVERNMENT USE: If you are acquiring this software on behalf of the
+ * U.S. government, the Government shall have only "Restricted Rights"
+ * in the software and related documentation as defined in the Federal
+ * Acquisition Regulations (FARs) in Clause 52.227.19 (c) (2).  If you
+ * are acquiring the software on behalf of the Department of Defense,
+ * the software shall be classified as "Commercial Computer Software"
+ * and the Government shall have only "Restricted Rights" as defined in
+ * Clause 252.227-7013 (c) (1) of DFARs.  Notwithstanding the foregoing,
+ * the authors grant the U.S. Government and others acting in its behalf
+ * permission to use and distribute the software in accordance with the
+ * terms specified in this license.
+ *
+ * *++
+ * MODULE:
+ *  mechsJournal.c -- implementation of the event journal
+ * ABSTRACT:
+ *  The journal log is a fixed size file that is memory mapped. Records are
+ *  appended by copying them into the mapping so that there are no system
+ *  calls on the dispatch path. Groups of records are committed with a single
+ *  "msync". A checkpoint file holds an image of the class storage of the
+ *  journaled domains and the events that were pending when it was taken.
+ *
+ **--
+ */
+
+#ifdef MECH_JOURNAL
+
+#include "mechsJournal.h"
+#include "mechsIndex.h"
+
+#include <stdio.h>
+#include <errno.h>
+#include <assert.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#define COUNTOF(a)  (sizeof(a) / sizeof(a[0]))
+
+#define JRNL_LOG_MAGIC      "MECHJRNL"
+#define JRNL_CKPT_MAGIC     "MECHCKPT"
+#define JRNL_VERSION        5
+#define JRNL_ALIGN          8
+#define JRNL_ROUND(n)       (((n) + JRNL_ALIGN - 1) & ~(size_t)(JRNL_ALIGN - 1))
+#define JRNL_NO_SLOT        UINT32_MAX
+
+/*
+ * Kinds of records in the log.
+ */
+enum {
+    JRNL_REC_EVENT = 1,
+    JRNL_REC_PORTAL
+} ;
+
+/*
+ * Record flags.
+ */
+#define JRNL_EXTERNAL       0x01
+
+/*
+ * Event flags.
+ */
+#define JRNL_SUSPENDED      0x01
+
+/*
+ * Kinds of references to the target and source of an event.
+ */
+enum {
+    JRNL_REF_NONE,
+    JRNL_REF_INST,
+    JRNL_REF_CLASS
+} ;
+
+/*
+ * The log file begins with a header. The checkpoint generation ties the
+ * log to the checkpoint it follows.
+ */
+struct journalheader {
+    char magic[8] ;
+    uint32_t version ;
+    uint32_t generation ;
+    uint64_t size ;
+    uint64_t reserved[4] ;
+} ;
+
+/*
+ * Each record begins with a header. The sequence number and check value
+ * detect the end of the valid records when the log is read back.
+ */
+struct journalrecord {
+    uint32_t sequence ;
+    uint16_t length ;           /* total length, including this header */
+    uint8_t type ;
+    uint8_t flags ;
+    uint32_t dispatchCount ;    /* dispatches since the checkpoint */
+    uint32_t check ;
+} ;
+
+/*
+ * Position independent reference to an instance or a class.
+ */
+struct journalref {
+    uint8_t kind ;
+    uint8_t portal ;
+    uint16_t class ;
+    uint16_t inst ;
+} ;
+
+/*
+ * The predicate of a broadcast event is a function address and is
+ * recorded by value, as are pointer valued parameters. The cursor is the
+ * storage slot of the next instance to which a broadcast event is to be
+ * delivered, following the list of allocated instances. The period
+ * of a periodic event is zero for other events.
+ */
+struct journalevent {
+    struct journalref target ;
+    struct journalref source ;
+    uint8_t eventType ;
+    uint8_t eventNumber ;
+    uint8_t flags ;
+    uint16_t cursor ;
+    uint32_t delay ;
+    uint32_t period ;
+    uint64_t predicate ;
+    EventParamType params ;
+} ;
+
+struct journalportal {
+    uint8_t portal ;
+    uint8_t op ;
+    uint16_t class ;
+    uint16_t inst ;
+    uint16_t code ;
+    uint16_t size ;
+    /* followed by "size" bytes of data */
+} ;
+
+/*
+ * The checkpoint file begins with this header. It is followed by the
+ * storage of each writable class of each portal, in portal and class
+ * order, then by the slot of the first allocated instance of each of
+ * those classes and then by "pendingCount" event records. The slot of the
+ * first instance keeps the order of the allocated instances, which is
+ * the order in which broadcast events reach them.
+ */
+struct checkpointheader {
+    char magic[8] ;
+    uint32_t version ;
+    uint32_t generation ;
+    uint64_t portalBase ;       /* address of the first portal */
+    uint32_t portalCount ;
+    uint32_t pendingCount ;
+    uint64_t storageSize ;
+} ;
+
+static struct journal {
+    bool active ;
+    bool replaying ;
+    bool overflowed ;
+    int logFd ;
+    char const *ckptPath ;
+    char *log ;                 /* memory mapped log file */
+    size_t logSize ;
+    size_t position ;           /* offset of the next record */
+    size_t committed ;          /* offset up to which records are committed */
+    unsigned uncommitted ;      /* records since the last commit */
+    uint32_t sequence ;
+    uint32_t generation ;
+    uint32_t dispatchCount ;
+    unsigned portalCount ;
+    struct pycca_domain_portal const *portals[MECH_JOURNAL_MAXPORTALS] ;
+} journal = {
+    .logFd = -1,
+} ;
+
+static uint32_t journalCheck(struct journalrecord const *, void const *,
+        size_t) ;
+static void *journalAppend(uint8_t, uint8_t, size_t) ;
+static bool journalRefOfInst(MechInstance, struct journalref *) ;
+static bool journalRefOfClass(MechClass, struct journalref *) ;
+static void journalEncodeEvent(MechEcb, MechDelayTime,
+        struct journalevent *) ;
+static int journalReplayEvent(struct journalevent const *) ;
+static int journalReplayPortal(struct journalportal const *) ;
+static void journalResetLog(void) ;
+static int journalRestoreCheckpoint(void) ;
+static void journalSavePending(MechEcb, MechDelayTime, void *) ;
+static bool writeAll(int, void const *, size_t) ;
+static bool readAll(int, void *, size_t) ;
+
+int
+mechJournalRegisterPortal(
+    struct pycca_domain_portal const *portal)
+{
+    if (journal.portalCount >= COUNTOF(journal.portals)) {
+        return -1 ;
+    }
+    journal.portals[journal.portalCount++] = portal ;
+    return 0 ;
+}
+
+int
+mechJournalOpen(
+    char const *logPath,
+    char const *ckptPath)
+{
+    assert(!journal.active) ;
+
+    int fd = open(logPath, O_RDWR | O_CREAT, 0644) ;
+    if (fd == -1) {
+        perror(logPath) ;
+        return -1 ;
+    }
+    /*
+     * The log is a fixed size so that appends never change the size of the
+     * file and committing it requires only that the pages be written.
+     */
+    if (ftruncate(fd, MECH_JOURNAL_LOGSIZE) == -1 || fsync(fd) == -1) {
+        perror(logPath) ;
+        close(fd) ;
+        return -1 ;
+    }
+    void *log = mmap(NULL, MECH_JOURNAL_LOGSIZE, PROT_READ | PROT_WRITE,
+            MAP_SHARED, fd, 0) ;
+    if (log == MAP_FAILED) {
+        perror("mmap()") ;
+        close(fd) ;
+        return -1 ;
+    }
+
+    journal.logFd = fd ;
+    journal.log = log ;
+    journal.logSize = MECH_JOURNAL_LOGSIZE ;
+    journal.ckptPath = ckptPath ;
+
+    struct journalheader *hdr = log ;
+    if (memcmp(hdr->magic, JRNL_LOG_MAGIC, sizeof(hdr->magic)) != 0 ||
+            hdr->version != JRNL_VERSION ||
+            hdr->size != journal.logSize) {
+        journal.generation = 0 ;
+        journalResetLog() ;
+    } else {
+        /*
+         * Find the end of the valid records.
+         */
+        journal.generation = hdr->generation ;
+        journal.position = JRNL_ROUND(sizeof(*hdr)) ;
+        journal.sequence = 0 ;
+        while (journal.position + sizeof(struct journalrecord) <=
+                journal.logSize) {
+            struct journalrecord const *rec = (struct journalrecord const *)
+                    (journal.log + journal.position) ;
+            if (rec->sequence != journal.sequence + 1 ||
+                    rec->length < sizeof(*rec) ||
+                    journal.position + rec->length > journal.logSize ||
+                    rec->check != journalCheck(rec, rec + 1,
+                        rec->length - sizeof(*rec))) {
+                break ;
+            }
+            journal.sequence = rec->sequence ;
+            journal.position += rec->length ;
+        }
+        journal.committed = journal.position ;
+    }
+
+    journal.uncommitted = 0 ;
+    journal.dispatchCount = 0 ;
+    journal.overflowed = false ;
+    journal.active = true ;
+    return 0 ;
+}
+
+int
+mechJournalRecover(void)
+{
+    if (!journal.active) {
+        return -1 ;
+    }
+
+    journal.replaying = true ;
+    int status = journalRestoreCheckpoint() ;
+    int replayed = 0 ;
+    journal.dispatchCount = 0 ;
+    /*
+     * Walk the records that were found when the log was opened.
+     */
+    for (size_t pos = JRNL_ROUND(sizeof(struct journalheader)) ;
+            status == 0 && pos < journal.position ; ) {
+        struct journalrecord const *rec =
+                (struct journalrecord const *)(journal.log + pos) ;
+        pos += rec->length ;
+        if ((rec->flags & JRNL_EXTERNAL) == 0) {
+            continue ;
+        }
+        /*
+         * Dispatch events until we reach the point where the record was
+         * originally made.
+         */
+        while (journal.dispatchCount < rec->dispatchCount &&
+                mechEventDispatchNext()) {
+            ; /* empty */
+        }
+        status = rec->type == JRNL_REC_EVENT ?
+            journalReplayEvent((struct journalevent const *)(rec + 1)) :
+            journalReplayPortal((struct journalportal const *)(rec + 1)) ;
+        ++replayed ;
+    }
+    journal.replaying = false ;
+
+    if (status != 0) {
+        return -1 ;
+    }
+    /*
+     * Start a new generation from the recovered state.
+     */
+    return mechJournalCheckpoint() == 0 ? replayed : -1 ;
+}
+
+int
+mechJournalCheckpoint(void)
+{
+    if (!journal.active) {
+        return -1 ;
+    }
+    /*
+     * Commit what is in the log. If the checkpoint fails, the log is still
+     * valid against the previous checkpoint.
+     */
+    mechJournalCommit() ;
+
+    char tmpPath[FILENAME_MAX] ;
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", journal.ckptPath) ;
+    int fd = open(tmpPath, O_WRONLY | O_CREAT | O_TRUNC, 0644) ;
+    if (fd == -1) {
+        perror(tmpPath) ;
+        return -1 ;
+    }
+
+    struct checkpointheader hdr ;
+    memset(&hdr, 0, sizeof(hdr)) ;
+    memcpy(hdr.magic, JRNL_CKPT_MAGIC, sizeof(hdr.magic)) ;
+    hdr.version = JRNL_VERSION ;
+    hdr.generation = journal.generation + 1 ;
+    hdr.portalBase = (uintptr_t)journal.portals[0] ;
+    hdr.portalCount = journal.portalCount ;
+    /*
+     * Count the pending events by saving them to a scratch area at the end
+     * of the file, after the storage images.
+     */
+    bool ok = writeAll(fd, &hdr, sizeof(hdr)) ;
+    for (unsigned p = 0 ; ok && p < journal.portalCount ; ++p) {
+        struct pycca_domain_portal const *portal = journal.portals[p] ;
+        for (unsigned c = 0 ; ok && c < portal->numClasses ; ++c) {
+            struct pycca_class_portal const *classes = portal->classes + c ;
+            /*
+             * Subtypes stored in the union of their supertype share its
+             * storage, which has already been written.
+             */
+            if (classes->isConst || classes->instOffset != 0) {
+                continue ;
+            }
+            size_t size = classes->instSize * classes->numInsts ;
+            ok = writeAll(fd, classes->storage, size) ;
+            hdr.storageSize += size ;
+        }
+    }
+    for (unsigned p = 0 ; ok && p < journal.portalCount ; ++p) {
+        struct pycca_domain_portal const *portal = journal.portals[p] ;
+        for (unsigned c = 0 ; ok && c < portal->numClasses ; ++c) {
+            struct pycca_class_portal const *classes = portal->classes + c ;
+            if (classes->isConst) {
+                continue ;
+            }
+            MechInstance first = classes->mechClass != NULL ?
+                    mechInstFirstAllocated(classes->mechClass) : NULL ;
+            uint32_t slot = first != NULL ?
+                    ((char *)first - (char *)classes->storage -
+                        classes->instOffset) / classes->instSize :
+                    JRNL_NO_SLOT ;
+            ok = writeAll(fd, &slot, sizeof(slot)) ;
+        }
+    }
+    struct {
+        int fd ;
+        bool ok ;
+        uint32_t count ;
+    } pending = {
+        .fd = fd,
+        .ok = ok,
+        .count = 0,
+    } ;
+    if (ok) {
+        mechEventForEachPending(journalSavePending, &pending) ;
+        ok = pending.ok ;
+    }
+    hdr.pendingCount = pending.count ;
+    ok = ok && lseek(fd, 0, SEEK_SET) == 0 && writeAll(fd, &hdr, sizeof(hdr)) ;
+    ok = ok && fsync(fd) == 0 ;
+    if (close(fd) == -1) {
+        ok = false ;
+    }
+    ok = ok && rename(tmpPath, journal.ckptPath) == 0 ;
+    if (!ok) {
+        perror("checkpoint") ;
+        return -1 ;
+    }
+    /*
+     * The checkpoint is now in place, so the log starts again.
+     */
+    journal.generation = hdr.generation ;
+    journalResetLog() ;
+    journal.dispatchCount = 0 ;
+    journal.overflowed = false ;
+    return 0 ;
+}
+
+void
+mechJournalCommit(void)
+{
+    if (!journal.active || journal.replaying) {
+        return ;
+    }
+    if (journal.position > journal.committed) {
+        /*
+         * "msync" requires a page aligned address.
+         */
+        size_t pageSize = (size_t)sysconf(_SC_PAGESIZE) ;
+        size_t start = journal.committed & ~(pageSize - 1) ;
+        if (msync(journal.log + start, journal.position - start,
+                MS_SYNC) == -1) {
+            perror("msync()") ;
+        }
+        journal.committed = journal.position ;
+    }
+    journal.uncommitted = 0 ;
+    /*
+     * Check point before the log fills, or if it has.
+     */
+    if (journal.overflowed || journal.position > journal.logSize / 4 * 3) {
+        mechJournalCheckpoint() ;
+    }
+}
+
+void
+mechJournalClose(void)
+{
+    if (!journal.active) {
+        return ;
+    }
+    mechJournalCommit() ;
+    munmap(journal.log, journal.logSize) ;
+    close(journal.logFd) ;
+    journal.log = NULL ;
+    journal.logFd = -1 ;
+    journal.active = false ;
+}
+
+void
+mechJournalEvent(
+    MechEcb ecb,
+    MechDelayTime delay,
+    bool external)
+{
+    if (!journal.active || journal.replaying) {
+        return ;
+    }
+    struct journalevent *evt = journalAppend(JRNL_REC_EVENT,
+            external ? JRNL_EXTERNAL : 0, sizeof(*evt)) ;
+    if (evt) {
+        journalEncodeEvent(ecb, delay, evt) ;
+        struct journalrecord *rec = (struct journalrecord *)evt - 1 ;
+        rec->check = journalCheck(rec, evt, rec->length - sizeof(*rec)) ;
+    }
+}
+
+void
+mechJournalPortal(
+    struct pycca_domain_portal const *portal,
+    MechJournalOp op,
+    ClassId_t class,
+    InstId_t inst,
+    unsigned code,
+    void const *data,
+    size_t size)
+{
+    if (!journal.active || journal.replaying) {
+        return ;
+    }
+    unsigned p ;
+    for (p = 0 ; p < journal.portalCount ; ++p) {
+        if (journal.portals[p] == portal) {
+            break ;
+        }
+    }
+    if (p >= journal.portalCount) {
+        return ;
+    }
+    struct journalportal *chg = journalAppend(JRNL_REC_PORTAL, JRNL_EXTERNAL,
+            sizeof(*chg) + size) ;
+    if (chg) {
+        chg->portal = p ;
+        chg->op = op ;
+        chg->class = class ;
+        chg->inst = inst ;
+        chg->code = code ;
+        chg->size = size ;
+        if (size != 0) {
+            memcpy(chg + 1, data, size) ;
+        }
+        struct journalrecord *rec = (struct journalrecord *)chg - 1 ;
+        rec->check = journalCheck(rec, chg, rec->length - sizeof(*rec)) ;
+    }
+}
+
+void
+mechJournalDispatched(void)
+{
+    ++journal.dispatchCount ;
+    if (journal.uncommitted >= MECH_JOURNAL_GROUPSIZE) {
+        mechJournalCommit() ;
+    }
+}
+
+/*
+ * FNV-1a hash of the record header, less its check field, and the payload.
+ */
+static uint32_t
+journalCheck(
+    struct journalrecord const *rec,
+    void const *payload,
+    size_t size)
+{
+    uint32_t hash = 2166136261u ;
+    struct journalrecord hdr = *rec ;
+    hdr.check = 0 ;
+    unsigned char const *b = (unsigned char const *)&hdr ;
+    for (size_t n = 0 ; n < sizeof(hdr) ; ++n) {
+        hash = (hash ^ b[n]) * 16777619u ;
+    }
+    b = payload ;
+    for (size_t n = 0 ; n < size ; ++n) {
+        hash = (hash ^ b[n]) * 16777619u ;
+    }
+    return hash ;
+}
+
+/*
+ * Reserve space for a record in the log and fill in its header. Returns a
+ * pointer to the payload or NULL if the log is full. The caller computes
+ * the check value once the payload is filled in.
+ */
+static void *
+journalAppend(
+    uint8_t type,
+    uint8_t flags,
+    size_t size)
+{
+    size_t length = JRNL_ROUND(sizeof(struct journalrecord) + size) ;
+    if (journal.position + length > journal.logSize) {
+        if (!journal.overflowed) {
+            fprintf(stderr, "event journal is full\n") ;
+            journal.overflowed = true ;
+        }
+        return NULL ;
+    }
+
+    struct journalrecord *rec =
+            (struct journalrecord *)(journal.log + journal.position) ;
+    memset(rec, 0, length) ;
+    rec->sequence = ++journal.sequence ;
+    rec->length = length ;
+    rec->type = type ;
+    rec->flags = flags ;
+    rec->dispatchCount = journal.dispatchCount ;
+    journal.position += length ;
+    ++journal.uncommitted ;
+    return rec + 1 ;
+}
+
+static bool
+journalRefOfInst(
+    MechInstance inst,
+    struct journalref *ref)
+{
+    memset(ref, 0, sizeof(*ref)) ;
+    if (inst == NULL) {
+        ref->kind = JRNL_REF_NONE ;
+        return true ;
+    }
+    /*
+     * The class of the instance narrows the search to the portal class
+     * that holds its storage.
+     */
+    for (unsigned p = 0 ; p < journal.portalCount ; ++p) {
+        struct pycca_domain_portal const *portal = journal.portals[p] ;
+        for (unsigned c = 0 ; c < portal->numClasses ; ++c) {
+            struct pycca_class_portal const *classes = portal->classes + c ;
+            if (classes->mechClass == inst->instClass) {
+                ref->kind = JRNL_REF_INST ;
+                ref->portal = p ;
+                ref->class = c ;
+                ref->inst = ((char *)inst - (char *)classes->storage -
+                        classes->instOffset) / classes->instSize ;
+                return true ;
+            }
+        }
+    }
+    return false ;
+}
+
+static bool
+journalRefOfClass(
+    MechClass mechClass,
+    struct journalref *ref)
+{
+    memset(ref, 0, sizeof(*ref)) ;
+    for (unsigned p = 0 ; p < journal.portalCount ; ++p) {
+        struct pycca_domain_portal const *portal = journal.portals[p] ;
+        for (unsigned c = 0 ; c < portal->numClasses ; ++c) {
+            if (portal->classes[c].mechClass == mechClass) {
+                ref->kind = JRNL_REF_CLASS ;
+                ref->portal = p ;
+                ref->class = c ;
+                return true ;
+            }
+        }
+    }
+    return false ;
+}
+
+static void
+journalEncodeEvent(
+    MechEcb ecb,
+    MechDelayTime delay,
+    struct journalevent *evt)
+{
+    if (ecb->eventType == CreationEvent) {
+        journalRefOfClass(ecb->instOrClass.targetClass, &evt->target) ;
+    } else if (ecb->eventType == BroadcastEvent) {
+        journalRefOfClass(ecb->instOrClass.targetClass, &evt->target) ;
+        evt->predicate = (uintptr_t)ecb->ext.predicate ;
+        evt->cursor = ecb->pos.cursor ;
+    } else {
+        journalRefOfInst(ecb->instOrClass.targetInst, &evt->target) ;
+        evt->period = ecb->ext.periodic.period ;
+    }
+    journalRefOfInst(ecb->srcInst, &evt->source) ;
+    evt->eventType = ecb->eventType ;
+    evt->eventNumber = ecb->eventNumber ;
+    evt->flags = ecb->delayed && ecb->suspended ? JRNL_SUSPENDED : 0 ;
+    evt->delay = delay ;
+    evt->params = ecb->eventParameters ;
+}
+
+static MechInstance
+journalInstOfRef(
+    struct journalref const *ref)
+{
+    if (ref->kind != JRNL_REF_INST || ref->portal >= journal.portalCount) {
+        return NULL ;
+    }
+    struct pycca_domain_portal const *portal = journal.portals[ref->portal] ;
+    if (ref->class >= portal->numClasses) {
+        return NULL ;
+    }
+    struct pycca_class_portal const *classes = portal->classes + ref->class ;
+    if (ref->inst >= classes->numInsts) {
+        return NULL ;
+    }
+    return (MechInstance)((char *)classes->storage +
+            classes->instSize * ref->inst + classes->instOffset) ;
+}
+
+static int
+journalReplayEvent(
+    struct journalevent const *evt)
+{
+    MechInstance source = journalInstOfRef(&evt->source) ;
+    MechEcb ecb ;
+
+    if (evt->eventType == CreationEvent ||
+            evt->eventType == BroadcastEvent) {
+        if (evt->target.kind != JRNL_REF_CLASS ||
+                evt->target.portal >= journal.portalCount) {
+            return -1 ;
+        }
+        struct pycca_domain_portal const *portal =
+                journal.portals[evt->target.portal] ;
+        if (evt->target.class >= portal->numClasses) {
+            return -1 ;
+        }
+        MechClass target = portal->classes[evt->target.class].mechClass ;
+        if (evt->eventType == CreationEvent) {
+            ecb = mechCreationEventNew(evt->eventNumber, target, source) ;
+        } else {
+            /*
+             * A broadcast taken from a checkpoint may have been part way
+             * through its targets, so delivery resumes at its cursor.
+             */
+            ecb = mechBroadcastEventNew(evt->eventNumber, target,
+                    (MechInstPredicate)(uintptr_t)evt->predicate, source) ;
+            mechBroadcastEventResume(ecb, evt->cursor) ;
+        }
+    } else {
+        MechInstance target = journalInstOfRef(&evt->target) ;
+        if (target == NULL) {
+            return -1 ;
+        }
+        ecb = evt->eventType == PolymorphicEvent ?
+            mechPolyEventNew(evt->eventNumber, target, source) :
+            mechEventNew(evt->eventNumber, target, source) ;
+    }
+    ecb->eventParameters = evt->params ;
+    /*
+     * A periodic event keeps its period and its next deadline follows
+     * from the time it had left to run.
+     */
+    if (evt->period != 0) {
+        ecb->ext.periodic.period = evt->period ;
+        ecb->ext.periodic.deadline =
+                (MechEcbTime)(mechNow() / 1000) + evt->delay ;
+    }
+    if (evt->flags & JRNL_SUSPENDED) {
+        mechEventPostSuspended(ecb, evt->delay) ;
+    } else if (evt->delay != 0) {
+        mechEventPostDelay(ecb, evt->delay) ;
+    } else {
+        mechEventPost(ecb) ;
+    }
+    return 0 ;
+}
+
+static int
+journalReplayPortal(
+    struct journalportal const *chg)
+{
+    if (chg->portal >= journal.portalCount) {
+        return -1 ;
+    }
+    struct pycca_domain_portal const *portal = journal.portals[chg->portal] ;
+    int result ;
+
+    switch (chg->op) {
+    case MechJournalUpdate:
+        result = pycca_update_attr(portal, chg->class, chg->inst, chg->code,
+                chg + 1, chg->size) ;
+        break ;
+    case MechJournalCreate:
+        result = pycca_create_instance(portal, chg->class) ;
+        break ;
+    case MechJournalDestroy:
+        result = pycca_destroy_instance(portal, chg->class, chg->inst) ;
+        break ;
+    case MechJournalReset:
+        result = pycca_reset_machine(portal, chg->class, chg->inst) ;
+        break ;
+    case MechJournalCancel:
+        result = pycca_cancel_delayed_event(portal, chg->class, chg->inst,
+                chg->code) ;
+        break ;
+    default:
+        result = -1 ;
+        break ;
+    }
+    return result < 0 ? -1 : 0 ;
+}
+
+/*
+ * Empty the log and start a new generation of records.
+ */
+static void
+journalResetLog(void)
+{
+    size_t used = journal.position > journal.committed ?
+            journal.position : journal.committed ;
+    size_t start = JRNL_ROUND(sizeof(struct journalheader)) ;
+    if (used > start) {
+        memset(journal.log + start, 0, used - start) ;
+    }
+    struct journalheader *hdr = (struct journalheader *)journal.log ;
+    memset(hdr, 0, sizeof(*hdr)) ;
+    memcpy(hdr->magic, JRNL_LOG_MAGIC, sizeof(hdr->magic)) ;
+    hdr->version = JRNL_VERSION ;
+    hdr->generation = journal.generation ;
+    hdr->size = journal.logSize ;
+    if (msync(journal.log, used > start ? used : start, MS_SYNC) == -1) {
+        perror("msync()") ;
+    }
+    journal.position = start ;
+    journal.committed = start ;
+    journal.uncommitted = 0 ;
+    journal.sequence = 0 ;
+}
+
+/*
+ * Restore the checkpoint that the log follows. A missing checkpoint is not
+ * an error if the log is for the first generation, i.e. it follows the
+ * initial instance population.
+ */
+static int
+journalRestoreCheckpoint(void)
+{
+    int fd = open(journal.ckptPath, O_RDONLY) ;
+    if (fd == -1) {
+        if (errno == ENOENT && journal.generation == 0) {
+            return 0 ;
+        }
+        perror(journal.ckptPath) ;
+        return -1 ;
+    }
+
+    struct checkpointheader hdr ;
+    int status = -1 ;
+    if (!readAll(fd, &hdr, sizeof(hdr)) ||
+            memcmp(hdr.magic, JRNL_CKPT_MAGIC, sizeof(hdr.magic)) != 0 ||
+            hdr.version != JRNL_VERSION) {
+        fprintf(stderr, "%s: not a checkpoint file\n", journal.ckptPath) ;
+    } else if (hdr.generation != journal.generation) {
+        fprintf(stderr, "%s: checkpoint does not match the journal\n",
+                journal.ckptPath) ;
+    } else if (hdr.portalBase != (uintptr_t)journal.portals[0] ||
+            hdr.portalCount != journal.portalCount) {
+        fprintf(stderr, "%s: checkpoint is for a different program image\n",
+                journal.ckptPath) ;
+    } else {
+        /*
+         * Events generated by domain initialization are superseded by
+         * those pending when the checkpoint was taken.
+         */
+        mechEventPurgeAll() ;
+        bool ok = true ;
+        for (unsigned p = 0 ; ok && p < journal.portalCount ; ++p) {
+            struct pycca_domain_portal const *portal = journal.portals[p] ;
+            for (unsigned c = 0 ; ok && c < portal->numClasses ; ++c) {
+                struct pycca_class_portal const *classes =
+                        portal->classes + c ;
+                if (classes->isConst || classes->instOffset != 0) {
+                    continue ;
+                }
+                ok = readAll(fd, classes->storage,
+                        classes->instSize * classes->numInsts) ;
+            }
+        }
+        for (unsigned p = 0 ; ok && p < journal.portalCount ; ++p) {
+            struct pycca_domain_portal const *portal = journal.portals[p] ;
+            for (unsigned c = 0 ; ok && c < portal->numClasses ; ++c) {
+                struct pycca_class_portal const *classes =
+                        portal->classes + c ;
+                if (classes->isConst) {
+                    continue ;
+                }
+                uint32_t slot ;
+                ok = readAll(fd, &slot, sizeof(slot)) &&
+                        (slot == JRNL_NO_SLOT || slot < classes->numInsts) ;
+                if (ok) {
+                    mechInstRestoreAllocated(classes->mechClass,
+                            slot == JRNL_NO_SLOT ? NULL :
+                            (MechInstance)((char *)classes->storage +
+                                slot * classes->instSize +
+                                classes->instOffset)) ;
+                }
+            }
+        }
+        /*
+         * The indexes refer to instances by their slots and hash the
+         * attribute values that were just replaced.
+         */
+        if (ok) {
+            mechIndexRebuildAll() ;
+        }
+        for (uint32_t e = 0 ; ok && e < hdr.pendingCount ; ++e) {
+            struct journalevent evt ;
+            ok = readAll(fd, &evt, sizeof(evt)) &&
+                    journalReplayEvent(&evt) == 0 ;
+        }
+        if (ok) {
+            status = 0 ;
+        } else {
+            fprintf(stderr, "%s: checkpoint is truncated\n",
+                    journal.ckptPath) ;
+        }
+    }
+    close(fd) ;
+    return status ;
+}
+
+static void
+journalSavePending(
+    MechEcb ecb,
+    MechDelayTime delay,
+    void *arg)
+{
+    struct {
+        int fd ;
+        bool ok ;
+        uint32_t count ;
+    } *pending = arg ;
+
+    if (pending->ok) {
+        struct journalevent evt ;
+        memset(&evt, 0, sizeof(evt)) ;
+        journalEncodeEvent(ecb, delay, &evt) ;
+        pending->ok = writeAll(pending->fd, &evt, sizeof(evt)) ;
+        ++pending->count ;
+    }
+}
+
+static bool
+writeAll(
+    int fd,
+    void const *buf,
+    size_t len)
+{
+    char const *place = buf ;
+    while (len != 0) {
+        ssize_t n = write(fd, place, len) ;
+        if (n == -1) {
+            if (errno == EINTR) {
+                continue ;
+            }
+            return false ;
+        }
+        place += n ;
+        len -= n ;
+    }
+    return true ;
+}
+
+static bool
+readAll(
+    int fd,
+    void *buf,
+    size_t len)
+{
+    char *place = buf ;
+    while (len != 0) {
+        ssize_t n = read(fd, place, len) ;
+        if (n == -1) {
+            if (errno == EINTR) {
+                continue ;
+            }
+            return false ;
+        } else if (n == 0) {
+            return false ;
+        }
+        place += n ;
+        len -= n ;
+    }
+    return true ;
+}
+
+#endif /* MECH_JOURNAL */
@@ -0,0 +1,203 @@
+/*
+ * This software is copyrighted 2008 by G. Andrew Mangogna.  The following
+ * terms apply to all files associated with the software unless explicitly
+ * disclaimed in individual files.
+ * 
+ * The author hereby grants permission to use, copy, modify, distribute,
+ * and license this software and its documentation for any purpose, provided
+ * that existing copyright notices are retained in all copies and that this
+ * notice is included verbatim in any distributions. No written agreement,
+ * license, or royalty fee is required for any of the authorized uses.
+ * Modifications to this software may be copyrighted by their authors and
+ * need not follow the licensing terms described here, provided that the
+ * new terms are clearly indicated on the first page of each file where
+ * they apply.
+ * 
+ * IN NO EVENT SHALL THE AUTHORS OR DISTRIBUTORS BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES ARISING
+ * OUT OF THE USE OF THIS SOFTWARE, ITS DOCUMENTATION, OR ANY DERIVATIVES
+ * THEREOF, EVEN IF THE AUTHORS HAVE BEEN ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * 
+ * THE AUTHORS AND DISTRIBUTORS SPECIFICALLY DISCLAIM ANY WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, AND NON-INFRINGEMENT.  THIS SOFTWARE
+ * IS PROVIDED ON AN "AS IS" BASIS, AND THE AUTHORS AND DISTRIBUTORS HAVE
+ * NO OBLIGATION TO PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS,
+ * OR MODIFICATIONS.
+ * 
+ * GOVERNMENT USE: If you are acquiring this software on behalf of the
+ * U.S. government, the Government shall have only "Restricted Rights"
+ * in the software and related documentation as defined in the Federal
+ * Acquisition Regulations (FARs) in Clause 52.227.19 (c) (2).  If you
+ * are acquiring the software on behalf of the Department of Defense,
+ * the software shall be classified as "Commercial Computer Software"
+ * and the Government shall have only "Restricted Rights" as defined in
+ * Clause 252.227-7013 (c) (1) of DFARs.  Notwithstanding the foregoing,
+ * the authors grant the U.S. Government and others acting in its behalf
+ * permission to use and distribute the software in accordance with the
+ * terms specified in this license.
+ *
+ * *++
+ * MODULE:
+ *  mechsJournal.h -- interface to the event journal
+ * ABSTRACT:
+ *  An optional write-ahead journal of the events accepted by the
+ *  mechanisms and the changes made to domain data through the portal.
+ *  The journal is used to recover the state of the domains after a crash.
+ **--
+ */
+
+#ifndef _MECHS_JOURNAL_H_
+#define _MECHS_JOURNAL_H_
+
+#include "mechs.h"
+#include "pycca_portal.h"
+
+/*
+ * Size of the journal log file. Records are appended to a memory mapped
+ * image of the file. When the log becomes three quarters full, a checkpoint
+ * is taken and the log is started again.
+ */
+#ifndef MECH_JOURNAL_LOGSIZE
+#   define MECH_JOURNAL_LOGSIZE     (1024 * 1024)
+#endif /* MECH_JOURNAL_LOGSIZE */
+
+/*
+ * Number of records that may accumulate before they are committed to
+ * stable storage, even if the mechanisms have not gone idle.
+ */
+#ifndef MECH_JOURNAL_GROUPSIZE
+#   define MECH_JOURNAL_GROUPSIZE   64
+#endif /* MECH_JOURNAL_GROUPSIZE */
+
+/*
+ * Maximum number of domain portals whose data is journaled.
+ */
+#ifndef MECH_JOURNAL_MAXPORTALS
+#   define MECH_JOURNAL_MAXPORTALS  4
+#endif /* MECH_JOURNAL_MAXPORTALS */
+
+/*
+ * The portal operations that are journaled.
+ */
+typedef enum {
+    MechJournalUpdate,      /* pycca_update_attr */
+    MechJournalCreate,      /* pycca_create_instance */
+    MechJournalDestroy,     /* pycca_destroy_instance */
+    MechJournalReset,       /* pycca_reset_machine */
+    MechJournalCancel       /* pycca_cancel_delayed_event */
+} MechJournalOp ;
+
+/*
+ * Register the portal of a domain whose events and data are journaled.
+ * Events are recorded by the identity of their target instance within a
+ * portal and checkpoints hold the storage of all the registered portals.
+ * All portals must be registered before the journal is opened.
+ */
+extern
+int                         /* Returns 0 on success, -1 if too many portals
+                             * have been registered. */
+mechJournalRegisterPortal(
+    struct pycca_domain_portal const *portal
+) ;
+
+/*
+ * Open the journal log, creating it if necessary, and begin journaling.
+ * Call this from "sysDomainInit" after the domains are initialized, so that
+ * events generated by domain initialization are not journaled. Any records
+ * already in the log are retained for "mechJournalRecover".
+ */
+extern
+int                         /* Returns 0 on success, -1 on error. */
+mechJournalOpen(
+    char const *logPath,    /* name of the log file */
+    char const *ckptPath    /* name of the checkpoint file */
+) ;
+
+/*
+ * Restore the last checkpoint, if there is one, and replay the events and
+ * portal changes that came from outside of the domains since then. Events
+ * generated by actions are not replayed since dispatching the replayed
+ * events generates them again. External events are injected at the same
+ * point in the dispatch sequence at which they were originally accepted.
+ * A new checkpoint is taken after replay.
+ *
+ * Checkpoints are images of the class storage and so contain pointers.
+ * A checkpoint can only be restored by the same program loaded at the same
+ * address, i.e. built without position independence or run without address
+ * space randomization. Pointer valued event parameters and attributes, and
+ * the predicates of broadcast events, are journaled by value and have the
+ * same restriction.
+ */
+extern
+int                         /* Returns the number of records replayed or
+                             * -1 on error. */
+mechJournalRecover(void) ;
+
+/*
+ * Write a checkpoint and empty the log. This must only be called between
+ * event dispatches. A checkpoint is also taken automatically when the log
+ * fills.
+ */
+extern
+int                         /* Returns 0 on success, -1 on error. */
+mechJournalCheckpoint(void) ;
+
+/*
+ * Commit the records appended since the last commit to stable storage.
+ * The mechanisms call this when they go idle and after every
+ * MECH_JOURNAL_GROUPSIZE records so that there is one "msync" for a group
+ * of records rather than one per record.
+ */
+extern
+void
+mechJournalCommit(void) ;
+
+/*
+ * Commit any outstanding records and close the journal.
+ */
+extern
+void
+mechJournalClose(void) ;
+
+/*
+ * Record that an event has been accepted for dispatch. Invoked by the
+ * event posting functions of the mechanisms.
+ */
+extern
+void
+mechJournalEvent(
+    MechEcb ecb,            /* the event being posted */
+    MechDelayTime delay,    /* the delay time in milliseconds, 0 if not
+                             * delayed */
+    bool external           /* true if the event was not generated by an
+                             * action */
+) ;
+
+/*
+ * Record a change made to domain data through the portal. Invoked by the
+ * portal functions that modify the domain.
+ */
+extern
+void
+mechJournalPortal(
+    struct pycca_domain_portal const *portal,
+    MechJournalOp op,       /* the portal operation */
+    ClassId_t class,        /* the class number */
+    InstId_t inst,          /* the instance number */
+    unsigned code,          /* attribute number for updates, event number
+                             * for cancels and otherwise zero */
+    void const *data,       /* new attribute value for updates */
+    size_t size             /* number of bytes in "data" */
+) ;
+
+/*
+ * Count an event dispatch. Invoked by the mechanisms after each event is
+ * dispatched.
+ */
+extern
+void
+mechJournalDispatched(void) ;
+
+#endif /* _MECHS_JOURNAL_H_ */
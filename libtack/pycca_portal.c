@@ -53,13 +53,52 @@
  */
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "mechs.h"
+#include "mechsIndex.h"
 #include "pycca_portal.h"
+#ifdef MECH_JOURNAL
+#   include "mechsJournal.h"
+#endif /* MECH_JOURNAL */
 
 /*
  * MACRO DEFINITIONS
  */
+/*
+ * Number of instances examined at a time when selecting by predicate.
+ */
+#ifndef PYCCA_SELECT_BLOCK
+#   define PYCCA_SELECT_BLOCK  64
+#endif /* PYCCA_SELECT_BLOCK */
+
+/*
+ * Apply a comparison to each of "n" values, clearing the corresponding "keep"
+ * flag when the comparison fails. The switch is outside of the loops so that
+ * each loop is a simple pass over contiguous arrays that the compiler can
+ * vectorize.
+ */
+#define PYCCA_COMPARE_BLOCK(values, compare, operand, keep, n)\
+    switch (compare) {\
+    case PYCCA_CMP_EQ:\
+        for (unsigned i = 0 ; i < (n) ; ++i) (keep)[i] &= (values)[i] == (operand) ;\
+        break ;\
+    case PYCCA_CMP_NE:\
+        for (unsigned i = 0 ; i < (n) ; ++i) (keep)[i] &= (values)[i] != (operand) ;\
+        break ;\
+    case PYCCA_CMP_LT:\
+        for (unsigned i = 0 ; i < (n) ; ++i) (keep)[i] &= (values)[i] < (operand) ;\
+        break ;\
+    case PYCCA_CMP_LE:\
+        for (unsigned i = 0 ; i < (n) ; ++i) (keep)[i] &= (values)[i] <= (operand) ;\
+        break ;\
+    case PYCCA_CMP_GT:\
+        for (unsigned i = 0 ; i < (n) ; ++i) (keep)[i] &= (values)[i] > (operand) ;\
+        break ;\
+    case PYCCA_CMP_GE:\
+        for (unsigned i = 0 ; i < (n) ; ++i) (keep)[i] &= (values)[i] >= (operand) ;\
+        break ;\
+    }
 
 /*
  * TYPE DEFINITIONS
@@ -73,10 +112,125 @@
  * EXTERNAL INLINE FUNCTION REFERENCES
  */
 
+/*
+ * STATIC INLINE FUNCTION DEFINITIONS
+ */
+
+/*
+ * Most attributes are scalars of the natural sizes. Copying those with a
+ * constant size lets the compiler turn the copy into a single load and store
+ * rather than a call to "memcpy()" for each value of a column.
+ */
+static inline void
+pycca_copy_value(
+    void *dst,
+    void const *src,
+    AttrSize_t size)
+{
+    switch (size) {
+    case sizeof(uint8_t):
+        memcpy(dst, src, sizeof(uint8_t)) ;
+        break ;
+
+    case sizeof(uint16_t):
+        memcpy(dst, src, sizeof(uint16_t)) ;
+        break ;
+
+    case sizeof(uint32_t):
+        memcpy(dst, src, sizeof(uint32_t)) ;
+        break ;
+
+    case sizeof(uint64_t):
+        memcpy(dst, src, sizeof(uint64_t)) ;
+        break ;
+
+    default:
+        memcpy(dst, src, size) ;
+        break ;
+    }
+}
+
+static inline int64_t
+pycca_load_int(
+    void const *src,
+    AttrSize_t size)
+{
+    switch (size) {
+    case sizeof(int8_t): {
+        int8_t v ;
+        memcpy(&v, src, sizeof(v)) ;
+        return v ;
+    }
+    case sizeof(int16_t): {
+        int16_t v ;
+        memcpy(&v, src, sizeof(v)) ;
+        return v ;
+    }
+    case sizeof(int32_t): {
+        int32_t v ;
+        memcpy(&v, src, sizeof(v)) ;
+        return v ;
+    }
+    default: {
+        int64_t v ;
+        memcpy(&v, src, sizeof(v)) ;
+        return v ;
+    }
+    }
+}
+
+static inline uint64_t
+pycca_load_uint(
+    void const *src,
+    AttrSize_t size)
+{
+    switch (size) {
+    case sizeof(uint8_t): {
+        uint8_t v ;
+        memcpy(&v, src, sizeof(v)) ;
+        return v ;
+    }
+    case sizeof(uint16_t): {
+        uint16_t v ;
+        memcpy(&v, src, sizeof(v)) ;
+        return v ;
+    }
+    case sizeof(uint32_t): {
+        uint32_t v ;
+        memcpy(&v, src, sizeof(v)) ;
+        return v ;
+    }
+    default: {
+        uint64_t v ;
+        memcpy(&v, src, sizeof(v)) ;
+        return v ;
+    }
+    }
+}
+
+static inline double
+pycca_load_float(
+    void const *src,
+    AttrSize_t size)
+{
+    if (size == sizeof(float)) {
+        float v ;
+        memcpy(&v, src, sizeof(v)) ;
+        return v ;
+    } else {
+        double v ;
+        memcpy(&v, src, sizeof(v)) ;
+        return v ;
+    }
+}
+
 /*
  * STATIC FUNCTION DECLARATIONS
  */
 
+static void pycca_eval_predicate(struct pycca_class_portal const *classes,
+    struct pycca_predicate const *pred, InstId_t const *blockIds, unsigned n,
+    uint8_t *keep) ;
 static int pycca_construct_event(struct pycca_domain_portal const *portal,
     ClassId_t class, InstId_t inst, MechEventType eventType, EventCode event,
     EventParamType *params, MechEcb *ecbRef) ;
@@ -177,6 +331,169 @@ pycca_get_attr_ref(
     return result ;
 }
 
+int
+pycca_read_state(
+    struct pycca_domain_portal const *portal,
+    ClassId_t class,
+    InstId_t inst,
+    StateCode *state)
+{
+    int result ;
+
+    if (class < portal->numClasses) {
+        struct pycca_class_portal const *classes = portal->classes + class ;
+        if (inst < classes->numInsts) {
+            MechInstance instRef = (MechInstance)((char *)classes->storage +
+                    classes->instSize * inst + classes->instOffset) ;
+            MechClass classData = classes->mechClass ;
+            if (classes->hasCommon == false) {
+                result = PYCCA_PORTAL_NO_STATES ;
+            } else if (instRef->alloc == 0) {
+                result = PYCCA_PORTAL_UNALLOC ;
+            } else if (classData == NULL || classData->odb == NULL) {
+                result = PYCCA_PORTAL_NO_STATES ;
+            } else {
+                if (state) {
+                    *state = instRef->currentState ;
+                }
+                result = 0 ;
+            }
+        } else {
+            result = PYCCA_PORTAL_NO_INST ;
+        }
+    } else {
+        result = PYCCA_PORTAL_NO_CLASS ;
+    }
+
+    return result ;
+}
+
+int
+pycca_read_columns(
+    struct pycca_domain_portal const *portal,
+    ClassId_t class,
+    struct pycca_column *columns,
+    unsigned ncols,
+    InstId_t *ids)
+{
+    if (class >= portal->numClasses) {
+        return PYCCA_PORTAL_NO_CLASS ;
+    }
+    struct pycca_class_portal const *classes = portal->classes + class ;
+    /*
+     * Validate all the columns before any values are copied.
+     */
+    for (unsigned col = 0 ; col < ncols ; ++col) {
+        struct pycca_column *column = columns + col ;
+        if (column->attr >= classes->numAttrs) {
+            return PYCCA_PORTAL_NO_ATTR ;
+        }
+        column->width = classes->attrs[column->attr].size ;
+    }
+
+    int count = 0 ;
+    char *instStorage = (char *)classes->storage + classes->instOffset ;
+    for (InstId_t inst = 0 ; inst < classes->numInsts ;
+            ++inst, instStorage += classes->instSize) {
+        MechInstance instRef = (MechInstance)instStorage ;
+        if (classes->hasCommon == true && instRef->alloc == 0) {
+            continue ;
+        }
+        for (unsigned col = 0 ; col < ncols ; ++col) {
+            struct pycca_column *column = columns + col ;
+            size_t place = (size_t)count * column->width ;
+            if (place + column->width > column->capacity) {
+                return PYCCA_PORTAL_NO_SPACE ;
+            }
+            pycca_copy_value((char *)column->values + place,
+                    instStorage + classes->attrs[column->attr].offset,
+                    column->width) ;
+        }
+        if (ids) {
+            ids[count] = inst ;
+        }
+        ++count ;
+    }
+
+    return count ;
+}
+
+int
+pycca_select(
+    struct pycca_domain_portal const *portal,
+    ClassId_t class,
+    struct pycca_predicate const *preds,
+    unsigned npreds,
+    InstId_t *ids)
+{
+    if (class >= portal->numClasses) {
+        return PYCCA_PORTAL_NO_CLASS ;
+    }
+    struct pycca_class_portal const *classes = portal->classes + class ;
+    /*
+     * Validate the predicates before scanning.
+     */
+    for (unsigned p = 0 ; p < npreds ; ++p) {
+        struct pycca_predicate const *pred = preds + p ;
+        if (pred->attr >= classes->numAttrs) {
+            return PYCCA_PORTAL_NO_ATTR ;
+        }
+        AttrSize_t size = classes->attrs[pred->attr].size ;
+        bool isScalar ;
+        switch (pred->type) {
+        case PYCCA_VALUE_INT:
+        case PYCCA_VALUE_UINT:
+            isScalar = size == sizeof(uint8_t) || size == sizeof(uint16_t) ||
+                    size == sizeof(uint32_t) || size == sizeof(uint64_t) ;
+            break ;
+        case PYCCA_VALUE_FLOAT:
+            isScalar = size == sizeof(float) || size == sizeof(double) ;
+            break ;
+        default:
+            isScalar = false ;
+            break ;
+        }
+        if (!isScalar) {
+            return PYCCA_PORTAL_NOT_SCALAR ;
+        }
+    }
+
+    int count = 0 ;
+    for (unsigned base = 0 ; base < classes->numInsts ;
+            base += PYCCA_SELECT_BLOCK) {
+        /*
+         * Collect the allocated instances of this block.
+         */
+        InstId_t blockIds[PYCCA_SELECT_BLOCK] ;
+        uint8_t keep[PYCCA_SELECT_BLOCK] ;
+        unsigned n = 0 ;
+        unsigned end = base + PYCCA_SELECT_BLOCK < classes->numInsts ?
+                base + PYCCA_SELECT_BLOCK : classes->numInsts ;
+        for (unsigned inst = base ; inst < end ; ++inst) {
+            MechInstance instRef = (MechInstance)((char *)classes->storage +
+                    classes->instSize * inst + classes->instOffset) ;
+            if (classes->hasCommon == false || instRef->alloc != 0) {
+                blockIds[n] = inst ;
+                keep[n] = 1 ;
+                ++n ;
+            }
+        }
+        /*
+         * Narrow the block by each predicate in turn.
+         */
+        for (unsigned p = 0 ; p < npreds ; ++p) {
+            pycca_eval_predicate(classes, preds + p, blockIds, n, keep) ;
+        }
+        for (unsigned i = 0 ; i < n ; ++i) {
+            if (keep[i]) {
+                ids[count++] = blockIds[i] ;
+            }
+        }
+    }
+
+    return count ;
+}
+
 int
 pycca_update_attr(
     struct pycca_domain_portal const *portal,
@@ -199,7 +516,13 @@ pycca_update_attr(
                     if (!classes->isConst) {
                         void *dst = (void *)((char *)instRef + attrs->offset) ;
                         result = size < attrs->size ? size : attrs->size ;
+                        mechIndexAttrUpdate(dst, true) ;
                         memcpy(dst, src, result) ;
+                        mechIndexAttrUpdate(dst, false) ;
+#                       ifdef MECH_JOURNAL
+                        mechJournalPortal(portal, MechJournalUpdate, class,
+                                inst, attr, src, result) ;
+#                       endif /* MECH_JOURNAL */
                     } else {
                         result = PYCCA_PORTAL_NO_UPDATE ;
                     }
@@ -311,6 +634,11 @@ pycca_cancel_delayed_event(
             MechInstance instRef = (MechInstance)((char *)classes->storage +
                     classes->instSize * inst + classes->instOffset) ;
             mechEventDelayCancel(event, instRef, NULL) ;
+#           ifdef MECH_JOURNAL
+            mechJournalPortal(portal, MechJournalCancel, class, inst, event,
+                    NULL, 0) ;
+#           endif /* MECH_JOURNAL */
+            result = 0 ;
         } else {
             result = PYCCA_PORTAL_NO_INST ;
         }
@@ -338,6 +666,10 @@ pycca_reset_machine(
             if (classes->hasCommon == true && classData != NULL) {
                 if (instRef->alloc != 0) {
                     instRef->currentState =  classes->initialState ;
+#                   ifdef MECH_JOURNAL
+                    mechJournalPortal(portal, MechJournalReset, class, inst,
+                            0, NULL, 0) ;
+#                   endif /* MECH_JOURNAL */
                     result = 0 ;
                 } else {
                     result = PYCCA_PORTAL_UNALLOC ;
@@ -374,6 +706,10 @@ pycca_create_instance(
              */
             result = ((char *)instRef - (char *)classes->storage -
                     classes->instOffset) / classes->instSize ;
+#           ifdef MECH_JOURNAL
+            mechJournalPortal(portal, MechJournalCreate, class, result, 0,
+                    NULL, 0) ;
+#           endif /* MECH_JOURNAL */
         } else {
             result = PYCCA_PORTAL_NO_DYNAMIC ;
         }
@@ -402,6 +738,10 @@ pycca_destroy_instance(
                     classData->iab != NULL) {
                 if (instRef->alloc != 0) {
                     mechInstDestroy(instRef) ;
+#                   ifdef MECH_JOURNAL
+                    mechJournalPortal(portal, MechJournalDestroy, class, inst,
+                            0, NULL, 0) ;
+#                   endif /* MECH_JOURNAL */
                     result = 0 ;
                 } else {
                     result = PYCCA_PORTAL_UNALLOC ;
@@ -423,6 +763,53 @@ pycca_destroy_instance(
  * STATIC FUNCTION DEFINITIONS
  */
 
+static void
+pycca_eval_predicate(
+    struct pycca_class_portal const *classes,
+    struct pycca_predicate const *pred,
+    InstId_t const *blockIds,
+    unsigned n,
+    uint8_t *keep)
+{
+    AttrOffset_t offset = classes->attrs[pred->attr].offset ;
+    AttrSize_t size = classes->attrs[pred->attr].size ;
+    char const *base = (char const *)classes->storage + classes->instOffset +
+            offset ;
+    /*
+     * Gather the attribute values of the block into a contiguous array and
+     * then compare the whole array.
+     */
+    switch (pred->type) {
+    case PYCCA_VALUE_INT: {
+        int64_t values[PYCCA_SELECT_BLOCK] ;
+        for (unsigned i = 0 ; i < n ; ++i) {
+            values[i] = pycca_load_int(
+                    base + classes->instSize * blockIds[i], size) ;
+        }
+        PYCCA_COMPARE_BLOCK(values, pred->compare, pred->operand.i, keep, n)
+        break ;
+    }
+    case PYCCA_VALUE_UINT: {
+        uint64_t values[PYCCA_SELECT_BLOCK] ;
+        for (unsigned i = 0 ; i < n ; ++i) {
+            values[i] = pycca_load_uint(
+                    base + classes->instSize * blockIds[i], size) ;
+        }
+        PYCCA_COMPARE_BLOCK(values, pred->compare, pred->operand.u, keep, n)
+        break ;
+    }
+    case PYCCA_VALUE_FLOAT: {
+        double values[PYCCA_SELECT_BLOCK] ;
+        for (unsigned i = 0 ; i < n ; ++i) {
+            values[i] = pycca_load_float(
+                    base + classes->instSize * blockIds[i], size) ;
+        }
+        PYCCA_COMPARE_BLOCK(values, pred->compare, pred->operand.f, keep, n)
+        break ;
+    }
+    }
+}
+
 static int
 pycca_construct_event(
     struct pycca_domain_portal const *portal,
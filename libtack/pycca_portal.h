@@ -60,6 +60,7 @@
  */
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "mechs.h"
 
@@ -106,6 +107,14 @@
      * Class does not support dynamic instances.
      */
 #define PYCCA_PORTAL_NO_DYNAMIC     (-9)
+    /*
+     * Supplied buffer is too small to hold the result.
+     */
+#define PYCCA_PORTAL_NO_SPACE       (-10)
+    /*
+     * Attribute is not a scalar of the type given in a predicate.
+     */
+#define PYCCA_PORTAL_NOT_SCALAR     (-11)
 
 /*
  * TYPE DECLARATIONS
@@ -139,6 +148,55 @@ struct pycca_domain_portal {
     ClassId_t numClasses ;
 } ;
 
+/*
+ * A column descriptor. Columns are used to gather the values of a single
+ * attribute across all the allocated instances of a class into contiguous
+ * storage, i.e. the values are laid out as an array of the attribute type.
+ */
+struct pycca_column {
+    AttrId_t attr ;     /* The number of the attribute to gather. */
+    void *values ;      /* A pointer to memory where the attribute values
+                         * are placed one after the other. */
+    size_t capacity ;   /* The number of bytes pointed to by "values". */
+    AttrSize_t width ;  /* Filled in on output to be the number of bytes
+                         * that each value occupies in "values". */
+} ;
+
+/*
+ * Predicates are used to select instances based on attribute values.
+ * Each predicate compares the value of one attribute to a constant operand.
+ * Since the portal only knows the size of an attribute, the predicate also
+ * states how the attribute value is to be interpreted.
+ */
+enum pycca_compare {
+    PYCCA_CMP_EQ,
+    PYCCA_CMP_NE,
+    PYCCA_CMP_LT,
+    PYCCA_CMP_LE,
+    PYCCA_CMP_GT,
+    PYCCA_CMP_GE
+} ;
+
+enum pycca_value_type {
+    PYCCA_VALUE_INT,    /* signed integer of 1, 2, 4 or 8 bytes */
+    PYCCA_VALUE_UINT,   /* unsigned integer of 1, 2, 4 or 8 bytes */
+    PYCCA_VALUE_FLOAT   /* float or double */
+} ;
+
+struct pycca_predicate {
+    AttrId_t attr ;                 /* The number of the attribute to test. */
+    enum pycca_compare compare ;    /* The comparison to make as:
+                                     *  <attribute> <compare> <operand> */
+    enum pycca_value_type type ;    /* The interpretation of the attribute
+                                     * value and of the operand. */
+    union {
+        int64_t i ;
+        uint64_t u ;
+        double f ;
+    } operand ;                     /* The value to compare against. The
+                                     * member used is given by "type". */
+} ;
+
 /*
  * EXTERNAL DATA DECLARATIONS
  */
@@ -201,6 +259,80 @@ pycca_get_attr_ref(
                          * occupies. */
 ) ;
 
+/*
+ * Read the current state of an instance. This is also the way to determine
+ * if an instance slot is allocated. Returns 0 upon success. Negative numbers
+ * are encoded as listed above. If the class does not have a state model, but
+ * the instance slot is allocated, then PYCCA_PORTAL_NO_STATES is returned.
+ */
+extern int
+pycca_read_state(
+    struct pycca_domain_portal
+        const *portal,  /* A pointer to the portal structure for the domain.
+                         * This structure is generated by when the -dataportal
+                         * option is given */
+    ClassId_t class,    /* The number of the class. This number is generated
+                         * by pycca and placed in the domain header file. */
+    InstId_t inst,      /* The number of the instance. Instance numbers are
+                         * consecutive non-negative integers up to the maximum
+                         * number of instances defined for the class. */
+    StateCode *state    /* A pointer to memory where the current state number
+                         * of the instance is placed. */
+) ;
+
+/*
+ * Gather the values of a set of attributes across all the allocated
+ * instances of a class. The instance storage is walked once and for each
+ * allocated instance the value of each requested attribute is appended to the
+ * "values" of the corresponding column. If the return value is non-negative,
+ * then it represents the number of instances gathered, i.e. the number of
+ * values placed in each column. Negative numbers are encoded as listed above.
+ */
+extern int
+pycca_read_columns(
+    struct pycca_domain_portal
+        const *portal,  /* A pointer to the portal structure for the domain.
+                         * This structure is generated by when the -dataportal
+                         * option is given */
+    ClassId_t class,    /* The number of the class. This number is generated
+                         * by pycca and placed in the domain header file. */
+    struct pycca_column
+        *columns,       /* A pointer to an array of column descriptors, one
+                         * for each attribute to be gathered. */
+    unsigned ncols,     /* The number of elements in the "columns" array. */
+    InstId_t *ids       /* A pointer to memory where the instance number of
+                         * each gathered instance is placed. There must be
+                         * room for as many ids as the class has instance
+                         * slots. This argument may be NULL if the instance
+                         * numbers are not needed. */
+) ;
+
+/*
+ * Select the allocated instances of a class for which all of a set of
+ * predicates are true, i.e. the predicates are joined by logical "and". The
+ * instances are examined in blocks so that each predicate is evaluated for a
+ * block of attribute values in a single tight loop. If the return value is
+ * non-negative, then it represents the number of matching instances.
+ * Negative numbers are encoded as listed above.
+ */
+extern int
+pycca_select(
+    struct pycca_domain_portal
+        const *portal,  /* A pointer to the portal structure for the domain.
+                         * This structure is generated by when the -dataportal
+                         * option is given */
+    ClassId_t class,    /* The number of the class. This number is generated
+                         * by pycca and placed in the domain header file. */
+    struct pycca_predicate
+        const *preds,   /* A pointer to an array of predicates. */
+    unsigned npreds,    /* The number of elements in the "preds" array. If
+                         * zero, then all allocated instances are selected. */
+    InstId_t *ids       /* A pointer to memory where the instance numbers of
+                         * the matching instances are placed. There must be
+                         * room for as many ids as the class has instance
+                         * slots. */
+) ;
+
 /*
  * Update an attribute value in a domain.  If the return value is non-negative,
  * then it represents the actual number of bytes copied into the attribute